@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+
+#include "engine-m/core.h"
+
+namespace EngineM {
+
+    // Owning, zero-initialised float buffer aligned for 256-bit loads. Backs the
+    // structure-of-arrays containers (MatrixArray, Vec3Array).
+    class ENGINE_M_API AlignedBuffer {
+        float *buffer = nullptr;
+        size_t length = 0;
+
+    public:
+        static constexpr size_t alignment = 32;
+
+        AlignedBuffer() = default;
+        explicit AlignedBuffer(size_t);
+        AlignedBuffer(const AlignedBuffer &);
+        AlignedBuffer(AlignedBuffer &&) noexcept;
+
+        // Copy assignment reuses the allocation when the sizes match, and otherwise
+        // allocates before releasing, so a failed allocation leaves the buffer unchanged.
+        AlignedBuffer& operator=(const AlignedBuffer &);
+        AlignedBuffer& operator=(AlignedBuffer &&) noexcept;
+
+        [[nodiscard]] float* data();
+        [[nodiscard]] const float* data() const;
+        [[nodiscard]] size_t size() const;
+
+        ~AlignedBuffer();
+    };
+}
@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "engine-m/core.h"
+#include "engine-m/constants.h"
 #include "curve.h"
 #include "engine-m/vector/vector.h"
 #include "engine-m/frame.h"
@@ -13,13 +14,23 @@ namespace EngineM {
         int degree;
         std::vector<vec3f> points;
 
+        // Control points pre-multiplied by their binomial coefficients, C(d, i) p_i, for the
+        // curve (degree + 1 points), its first (degree points) and its second hodograph
+        // (degree - 1 points), so evaluation is a Horner loop with no coefficient work. Up to
+        // powerBasisDegree, power-basis coefficients of the curve and both derivatives (laid
+        // out the same way) feed the SIMD batch evaluation. Rebuilt by every write to the
+        // control points, so const calls only read and are safe to make concurrently.
+        std::vector<vec3f> weighted;
+        std::vector<vec3f> power;
+
     public:
         BezierCurve() = delete;
         explicit BezierCurve(int);
         BezierCurve(int, const std::vector<vec3f> &);
-        BezierCurve(const BezierCurve &) = default;
 
     private:
+        void buildCache();
+
         [[nodiscard]] vec3f deCasteljau(float) const;
 
         [[nodiscard]] std::pair<std::unique_ptr<BezierCurve>, std::unique_ptr<BezierCurve>> deCasteljauSplit(float) const;
@@ -27,13 +38,49 @@ namespace EngineM {
         [[nodiscard]] float legendreGaussQuadratureLength() const;
 
     public:
-        BezierCurve& operator=(const BezierCurve &) = default;
+        // A control point of a non-const curve. Reads see the point and assignment goes
+        // through setPoint, so the cache is rebuilt by the write itself.
+        class PointReference {
+            BezierCurve &curve;
+            int index;
+
+        public:
+            PointReference(BezierCurve &curve, const int index): curve(curve), index(index) {
+
+            }
+
+            PointReference& operator=(const vec3f &point) {
+                curve.setPoint(index, point);
+                return *this;
+            }
+
+            PointReference& operator=(const PointReference &point) {
+                return *this = static_cast<const vec3f &>(point);
+            }
+
+            operator const vec3f&() const {
+                return curve.points[index];
+            }
+        };
 
         [[nodiscard]] vec3f evaluate(float) const override;
         [[nodiscard]] vec3f tangentAt(float) const override;
         [[nodiscard]] vec3f accelerationAt(float) const override;
         [[nodiscard]] vec3f normalAt(float) const override;
 
+        // Converting to the power basis loses about 3^degree ulps, so higher degrees fall back
+        // to the per-sample Bernstein evaluation.
+        static constexpr int powerBasisDegree = 5;
+
+        void evaluateMany(std::span<const float>, std::span<vec3f>) const override;
+        void tangentMany(std::span<const float>, std::span<vec3f>) const override;
+        void accelerationMany(std::span<const float>, std::span<vec3f>) const override;
+        void tessellate(std::span<vec3f>, std::span<vec3f>) const override;
+
+        // Adaptive polyline within the tolerance of the curve; see Curve::flattenControlPolygon.
+        // The vector is cleared and keeps its capacity.
+        void flatten(std::vector<vec3f> &, float tolerance = distance_tolerance) const;
+
         [[nodiscard]] std::pair<std::unique_ptr<Curve>, std::unique_ptr<Curve>> split(float) const override;
 
         [[nodiscard]] std::unique_ptr<Curve> derivative() const;
@@ -43,13 +90,14 @@ namespace EngineM {
 
         [[nodiscard]] float length() const override;
 
-        vec3f& operator[](int);
+        PointReference operator[](int);
         const vec3f& operator[](int) const;
 
         [[nodiscard]] int getDegree() const;
 
         [[nodiscard]] std::vector<vec3f> getPoints() const;
         void setPoints(const std::vector<vec3f> &);
+        void setPoint(int, const vec3f &);
 
         ~BezierCurve() override = default;
     };
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <span>
+#include <vector>
 
 #include "engine-m/core.h"
 #include "engine-m/vector/vector.h"
@@ -9,12 +11,49 @@
 namespace EngineM {
 
     class ENGINE_M_API Curve {
+    protected:
+        // Frenet frame from the position, tangent and acceleration at one parameter.
+        static Frame frenetFrame(const vec3f &, const vec3f &, const vec3f &);
+
+        // Evaluates power-basis coefficients c[0] + c[1] t + ... at each t clamped to [0, 1]
+        // with the SIMD polynomial kernel.
+        static void evaluatePowerBasis(std::span<const vec3f>, std::span<const float>, std::span<vec3f>);
+
+        // Samples power-basis coefficients (at most eight) at t = i / (n - 1) for the n outputs
+        // by forward differencing, re-anchored on exact evaluations to bound float drift.
+        static void forwardDifference(std::span<const vec3f>, std::span<vec3f>);
+
+        // Appends to the cleared vector the start of a Bezier control polygon, then the end of
+        // every piece of its midpoint de Casteljau subdivision whose interior control points lie
+        // within the tolerance of the piece's chord. The curve stays in the convex hull of its
+        // control points, so no point of it is further than the tolerance from the polyline.
+        // Subdivision stops at maxFlattenDepth and works on the stack up to
+        // maxFlattenPoints control points.
+        static void flattenControlPolygon(std::span<const vec3f>, float, std::vector<vec3f> &);
+
+        static constexpr int maxFlattenDepth = 16;
+        static constexpr size_t maxFlattenPoints = 16;
+
     public:
         [[nodiscard]] virtual vec3f evaluate(float) const = 0;
         [[nodiscard]] virtual vec3f tangentAt(float) const = 0;
         [[nodiscard]] virtual vec3f accelerationAt(float) const = 0;
         [[nodiscard]] virtual vec3f normalAt(float) const = 0;
 
+        // Batched evaluate, tangentAt, accelerationAt and getFrenetFrame at every t of the
+        // first span, written to the second, which must be the same size. The defaults loop
+        // over the single-parameter calls; framesMany is built on the other three, so curves
+        // overriding those get it vectorised too.
+        virtual void evaluateMany(std::span<const float>, std::span<vec3f>) const;
+        virtual void tangentMany(std::span<const float>, std::span<vec3f>) const;
+        virtual void accelerationMany(std::span<const float>, std::span<vec3f>) const;
+        virtual void framesMany(std::span<const float>, std::span<Frame>) const;
+
+        // Positions, and tangents unless the second span is empty, at n uniformly spaced
+        // parameters from 0 to 1 inclusive, where n is the size of the first span. The
+        // default evaluates each parameter through evaluateMany and tangentMany.
+        virtual void tessellate(std::span<vec3f>, std::span<vec3f>) const;
+
         [[nodiscard]] virtual std::pair<std::unique_ptr<Curve>, std::unique_ptr<Curve>> split(float) const = 0;
 
         [[nodiscard]] virtual Frame getFrenetFrame(float) const = 0;
@@ -24,4 +63,4 @@ namespace EngineM {
 
         virtual ~Curve() = default;
     };
-}
\ No newline at end of file
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "engine-m/core.h"
+#include "engine-m/constants.h"
 #include "curve.h"
 #include <vector>
 #include "engine-m/vector/vector.h"
@@ -21,6 +22,9 @@ namespace EngineM {
     private:
         [[nodiscard]] float legendreGaussQuadratureLength() const;
 
+        // c[0] + c[1] t + c[2] t^2 + c[3] t^3 = evaluate(t).
+        void powerBasis(vec3f (&)[4]) const;
+
     public:
         HermiteCurve& operator=(const HermiteCurve &) = default;
 
@@ -29,6 +33,15 @@ namespace EngineM {
         [[nodiscard]] vec3f accelerationAt(float) const override;
         [[nodiscard]] vec3f normalAt(float) const override;
 
+        void evaluateMany(std::span<const float>, std::span<vec3f>) const override;
+        void tangentMany(std::span<const float>, std::span<vec3f>) const override;
+        void accelerationMany(std::span<const float>, std::span<vec3f>) const override;
+        void tessellate(std::span<vec3f>, std::span<vec3f>) const override;
+
+        // Adaptive polyline within the tolerance of the curve, through its Bezier form; see
+        // Curve::flattenControlPolygon. The vector is cleared and keeps its capacity.
+        void flatten(std::vector<vec3f> &, float tolerance = distance_tolerance) const;
+
         [[nodiscard]] std::pair<std::unique_ptr<Curve>, std::unique_ptr<Curve>> split(float) const override;
 
         [[nodiscard]] Frame getFrenetFrame(float) const override;
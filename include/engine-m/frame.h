@@ -1,19 +1,21 @@
 #pragma once
 
 #include "engine-m/core.h"
-#include "engine-m/vector/vector.h"
+#include "engine-m/vector/vec3a.h"
 
 namespace EngineM {
 
+    // Axes are stored as vec3fa so frame propagation runs in SSE registers; they convert
+    // implicitly to and from vec3f.
     class ENGINE_M_API Frame {
     public:
-        vec3f origin;
-        vec3f tangent;
-        vec3f normal;
-        vec3f rotationAxis;
+        vec3fa origin;
+        vec3fa tangent;
+        vec3fa normal;
+        vec3fa rotationAxis;
 
         Frame() = default;
-        Frame(const vec3f &, const vec3f &, const vec3f &, const vec3f &);
+        Frame(const vec3fa &, const vec3fa &, const vec3fa &, const vec3fa &);
         Frame(const Frame &) = default;
 
         Frame& operator=(const Frame &) = default;
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "engine-m/core.h"
+#include "engine-m/simd.h"
+
+namespace EngineM::kernels {
+
+    struct MatrixKernels {
+        void (*matrix_add)(const float (&)[3][3], const float (&)[3][3], float (&)[3][3]);
+        void (*matrix_sub)(const float (&)[3][3], const float (&)[3][3], float (&)[3][3]);
+        void (*matrix_mul_by_k)(const float (&)[3][3], float, float (&)[3][3]);
+        void (*matrix_mul)(const float (&)[3][3], const float (&)[3][3], float (&)[3][3]);
+
+        // Element-wise over n contiguous floats.
+        void (*array_add)(const float *, const float *, float *, size_t);
+        void (*array_sub)(const float *, const float *, float *, size_t);
+        void (*array_mul_by_k)(const float *, float, float *, size_t);
+
+        // count row-major 3x3 matrices stored back to back.
+        void (*matrix_mul_aos)(const float *, const float *, float *, size_t);
+        // count matrices stored as 9 element streams, each stride floats apart.
+        void (*matrix_mul_soa)(const float *, const float *, float *, size_t, size_t);
+
+        // mat3f with rows padded to four floats and 16-byte aligned.
+        void (*matrix_padded_add)(const float (&)[3][4], const float (&)[3][4], float (&)[3][4]);
+        void (*matrix_padded_sub)(const float (&)[3][4], const float (&)[3][4], float (&)[3][4]);
+        void (*matrix_padded_mul_by_k)(const float (&)[3][4], float, float (&)[3][4]);
+        void (*matrix_padded_mul)(const float (&)[3][4], const float (&)[3][4], float (&)[3][4]);
+
+        void (*matrix4_add)(const float (&)[4][4], const float (&)[4][4], float (&)[4][4]);
+        void (*matrix4_sub)(const float (&)[4][4], const float (&)[4][4], float (&)[4][4]);
+        void (*matrix4_mul_by_k)(const float (&)[4][4], float, float (&)[4][4]);
+        void (*matrix4_mul)(const float (&)[4][4], const float (&)[4][4], float (&)[4][4]);
+        void (*matrix4_transpose)(const float (&)[4][4], float (&)[4][4]);
+        void (*matrix4_mul_vector)(const float (&)[4][4], const float (&)[4], float (&)[4]);
+        // Inverts [R t; 0 1]; returns false when R is singular.
+        bool (*matrix4_affine_inverse)(const float (&)[4][4], float (&)[4][4]);
+
+        // Applies the 3x4 affine transform to count points, interleaved xyz or as three streams.
+        void (*transform_aos)(const float (&)[3][4], const float *, float *, size_t);
+        void (*transform_soa)(const float (&)[3][4], const float *, const float *, const float *, float *, float *, float *, size_t);
+    };
+
+    struct CurveKernels {
+        // out = a * (1 - t) + b * t over n contiguous floats.
+        void (*lerp)(const float *, const float *, float, float *, size_t);
+        // Evaluates the xyz polynomial with power-basis coefficients c[0..degree] by Horner's
+        // rule at count parameters, writing interleaved xyz.
+        void (*polynomial)(const float *, size_t, const float *, float *, size_t);
+    };
+
+    // Kernels over structure-of-arrays vec3f streams. Outputs may alias inputs.
+    struct VectorKernels {
+        void (*soa_dot)(const float *, const float *, const float *, const float *, const float *, const float *, float *, size_t);
+        void (*soa_cross)(const float *, const float *, const float *, const float *, const float *, const float *, float *, float *, float *, size_t);
+        void (*soa_length)(const float *, const float *, const float *, float *, size_t);
+        // Zero-length vectors are left unchanged.
+        void (*soa_normalise)(const float *, const float *, const float *, float *, float *, float *, size_t);
+        // Reciprocal square root estimate plus one Newton-Raphson step (about 1e-6 relative
+        // error) instead of sqrt and divide. The scalar tier is exact.
+        void (*soa_normalise_fast)(const float *, const float *, const float *, float *, float *, float *, size_t);
+        // Converts between x, y, z streams and interleaved xyz points. Outputs must not alias inputs.
+        void (*interleave3)(const float *, const float *, const float *, float *, size_t);
+        void (*deinterleave3)(const float *, float *, float *, float *, size_t);
+        // IEEE half conversion of n floats with round-to-nearest-even (F16C on the AVX2 tiers).
+        void (*half_encode)(const float *, uint16_t *, size_t);
+        void (*half_decode)(const uint16_t *, float *, size_t);
+        // n floats clamped to [-1, 1] and scaled by 32767.
+        void (*snorm16_encode)(const float *, int16_t *, size_t);
+        void (*snorm16_decode)(const int16_t *, float *, size_t);
+        // count interleaved xyz unit vectors to and from pairs of octahedral snorm16 coordinates.
+        void (*octahedral_encode)(const float *, int16_t *, size_t);
+        void (*octahedral_decode)(const int16_t *, float *, size_t);
+        // Reductions over count interleaved xyz points. Bounds and the dot range start from
+        // +/-infinity; sums and covariance (six centred second moments xx, xy, xz, yy, yz, zz)
+        // accumulate in float, so callers should reduce in blocks.
+        void (*reduce_bounds)(const float *, size_t, float *, float *);
+        void (*reduce_sum)(const float *, size_t, float *);
+        void (*reduce_covariance)(const float *, size_t, const float *, float *);
+        void (*reduce_dot_range)(const float *, size_t, const float *, float *, float *);
+    };
+
+    // Kernels over arrays of quaternions stored as (x, y, z, w) float quadruples.
+    struct QuaternionKernels {
+        // Rotates count interleaved xyz points, each by its own unit quaternion. out may alias in.
+        void (*quaternion_rotate)(const float *, const float *, float *, size_t);
+        // Interpolates count (x, y, z, w) quaternion pairs, each by its own t, along the shorter
+        // arc. nlerp normalises the linear blend; slerp_fast weights both ends with a polynomial
+        // approximation of sin(t θ) / sin θ (within 2e-5), avoiding acos and sin. out may alias a or b.
+        void (*quaternion_nlerp)(const float *, const float *, const float *, float *, size_t);
+        void (*quaternion_slerp_fast)(const float *, const float *, const float *, float *, size_t);
+        // Rotation matrices of count unit quaternions, written row-major as packed 3x3 (9 floats)
+        // or 3x4 with a zero translation column (12 floats).
+        void (*quaternion_to_matrix3)(const float *, float *, size_t);
+        void (*quaternion_to_matrix34)(const float *, float *, size_t);
+
+        // Blends the dual quaternions (8 floats: real then dual, each x, y, z, w) of up to four
+        // bones per vertex. joints and weights hold four entries per vertex; the normalised
+        // result is written as eight streams of count floats, stride floats apart.
+        void (*dual_quaternion_blend)(const float *, const int32_t *, const float *, float *, size_t, size_t);
+        // Transforms SoA points (rotation and translation) or vectors (rotation only) by the
+        // blended dual quaternion streams. Outputs may alias the inputs.
+        void (*dual_quaternion_transform_points)(const float *, size_t, const float *, const float *, const float *, float *, float *, float *, size_t);
+        void (*dual_quaternion_transform_vectors)(const float *, size_t, const float *, const float *, const float *, float *, float *, float *, size_t);
+    };
+
+    // Kernel table for the given level.
+    ENGINE_M_API const MatrixKernels& get_matrix_kernels(SIMD::Level);
+
+    // Kernel table for SIMD::get_active_level().
+    ENGINE_M_API const MatrixKernels& get_matrix_kernels();
+
+    ENGINE_M_API const CurveKernels& get_curve_kernels(SIMD::Level);
+    ENGINE_M_API const CurveKernels& get_curve_kernels();
+
+    ENGINE_M_API const VectorKernels& get_vector_kernels(SIMD::Level);
+    ENGINE_M_API const VectorKernels& get_vector_kernels();
+
+    ENGINE_M_API const QuaternionKernels& get_quaternion_kernels(SIMD::Level);
+    ENGINE_M_API const QuaternionKernels& get_quaternion_kernels();
+}
@@ -1,22 +1,121 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <limits>
+#include <type_traits>
 
 #include "engine-m/core.h"
+#include "engine-m/kernels.h"
+#include "engine-m/matrix/matrix_expression.h"
 #include "engine-m/vector/vector.h"
 #include "engine-m/utils.h"
 
 namespace EngineM {
 
+    enum class Layout {
+        // rows * cols tightly packed elements.
+        Packed,
+        // Each row padded to a multiple of 16 bytes and the matrix aligned for SIMD loads,
+        // e.g. a padded mat3f is three 16-byte rows, as std140 expects.
+        Padded
+    };
+
+    template <typename T, unsigned int n>
+    class LUDecomposition;
+
+    template <typename T, unsigned int n>
+    class CholeskyDecomposition;
+
     template <typename T, unsigned int rows, unsigned int cols>
+    class QRDecomposition;
+
+    template <typename T, unsigned int rows, unsigned int cols, Layout layout = Layout::Packed>
     class ENGINE_M_API Matrix {
-        T matrix[rows][cols] {};
+        template <typename, unsigned int, unsigned int, Layout>
+        friend class Matrix;
+
+        static constexpr unsigned int row_lanes = sizeof(T) < 16 ? 16 / sizeof(T) : 1;
+        static constexpr unsigned int stride = layout == Layout::Padded ? (cols + row_lanes - 1) / row_lanes * row_lanes : cols;
+        static constexpr size_t alignment = layout == Layout::Padded ? (sizeof(T) * rows * stride % 32 == 0 ? 32 : 16) : alignof(T);
+
+        alignas(alignment) T matrix[rows][stride] {};
+
+        // mat3f and mat4f arithmetic is routed through the runtime-dispatched SIMD kernels. A
+        // padded mat4f has the same row layout as a packed one.
+        static constexpr bool is_mat3f = std::is_same_v<T, float> && rows == 3 && cols == 3 && layout == Layout::Packed;
+        static constexpr bool is_mat3fa = std::is_same_v<T, float> && rows == 3 && cols == 3 && layout == Layout::Padded;
+        static constexpr bool is_mat4f = std::is_same_v<T, float> && rows == 4 && cols == 4;
+        static constexpr bool has_kernels = is_mat3f || is_mat3fa || is_mat4f;
+
+        static void kernel_add(const Matrix &a, const Matrix &b, Matrix &out) requires has_kernels {
+            if constexpr (is_mat3f) {
+                kernels::get_matrix_kernels().matrix_add(a.matrix, b.matrix, out.matrix);
+            } else if constexpr (is_mat3fa) {
+                kernels::get_matrix_kernels().matrix_padded_add(a.matrix, b.matrix, out.matrix);
+            } else {
+                kernels::get_matrix_kernels().matrix4_add(a.matrix, b.matrix, out.matrix);
+            }
+        }
+
+        static void kernel_sub(const Matrix &a, const Matrix &b, Matrix &out) requires has_kernels {
+            if constexpr (is_mat3f) {
+                kernels::get_matrix_kernels().matrix_sub(a.matrix, b.matrix, out.matrix);
+            } else if constexpr (is_mat3fa) {
+                kernels::get_matrix_kernels().matrix_padded_sub(a.matrix, b.matrix, out.matrix);
+            } else {
+                kernels::get_matrix_kernels().matrix4_sub(a.matrix, b.matrix, out.matrix);
+            }
+        }
+
+        static void kernel_mul_by_k(const Matrix &a, const T k, Matrix &out) requires has_kernels {
+            if constexpr (is_mat3f) {
+                kernels::get_matrix_kernels().matrix_mul_by_k(a.matrix, k, out.matrix);
+            } else if constexpr (is_mat3fa) {
+                kernels::get_matrix_kernels().matrix_padded_mul_by_k(a.matrix, k, out.matrix);
+            } else {
+                kernels::get_matrix_kernels().matrix4_mul_by_k(a.matrix, k, out.matrix);
+            }
+        }
+
+        // Writes an element-wise expression into this matrix. A lone a + b, a - b or a * k on
+        // kernel-backed types runs the SIMD kernel; anything longer is fused into one loop. Each
+        // element only reads the same element of its operands, so aliasing is safe.
+        template <MatrixExpression E>
+        constexpr void evaluate(const E &e) {
+            if (!std::is_constant_evaluated()) {
+                if constexpr (has_kernels && is_matrix_binary_of<std::plus<>, E, Matrix>) {
+                    kernel_add(e.left(), e.right(), *this);
+                    return;
+                } else if constexpr (has_kernels && is_matrix_binary_of<std::minus<>, E, Matrix>) {
+                    kernel_sub(e.left(), e.right(), *this);
+                    return;
+                } else if constexpr (has_kernels && is_matrix_scalar_of<std::multiplies<>, E, Matrix>) {
+                    kernel_mul_by_k(e.left(), e.scalar(), *this);
+                    return;
+                }
+            }
+            for (unsigned int i = 0; i < rows; i++) {
+                for (unsigned int j = 0; j < cols; j++) {
+                    matrix[i][j] = e(i, j);
+                }
+            }
+        }
 
     public:
+        using value_type = T;
+        using matrix_type = Matrix;
+        static constexpr unsigned int row_count = rows;
+        static constexpr unsigned int col_count = cols;
+        static constexpr bool is_matrix_expression = true;
+        static constexpr bool is_leaf = true;
+
         Matrix() = default;
 
-        explicit Matrix(std::initializer_list<T> list) {
+        constexpr explicit Matrix(std::initializer_list<T> list) {
             assert(list.size() == rows * cols);
 
             auto it = list.begin();
@@ -28,16 +127,25 @@ namespace EngineM {
             }
         }
 
-        explicit Matrix(const T matrix[rows][cols]) {
+        constexpr explicit Matrix(const T matrix[rows][cols]) {
             copy(matrix);
         }
 
-        Matrix(const Matrix &mat) {
+        constexpr Matrix(const Matrix &) = default;
+
+        template <Layout other>
+        constexpr explicit Matrix(const Matrix<T, rows, cols, other> &mat) requires (other != layout) {
             copy(mat.matrix);
         }
 
+        template <MatrixExpression E> requires (!E::is_leaf && MatchingMatrixExpressions<Matrix, E>)
+        constexpr Matrix(const E &e) {
+            evaluate(e);
+        }
+
     private:
-        void copy(const T matrix[rows][cols]) {
+        template <unsigned int n>
+        constexpr void copy(const T matrix[rows][n]) {
             for (int i = 0; i < rows; i++) {
                 for (int j = 0; j < cols; j++) {
                     this -> matrix[i][j] = matrix[i][j];
@@ -46,88 +154,107 @@ namespace EngineM {
         }
 
     public:
-        Matrix& operator=(const Matrix &mat) {
-            if (this == &mat) {
-                return *this;
-            }
-            copy(mat.matrix);
+        constexpr Matrix& operator=(const Matrix &) = default;
+
+        template <MatrixExpression E> requires (!E::is_leaf && MatchingMatrixExpressions<Matrix, E>)
+        constexpr Matrix& operator=(const E &e) {
+            evaluate(e);
             return *this;
         }
 
-        T* operator[](uint32_t i) {
+        constexpr T* operator[](uint32_t i) {
             return matrix[i];
         }
 
-        const T* operator[](uint32_t i) const {
+        constexpr const T* operator[](uint32_t i) const {
             return matrix[i];
         }
 
-        Matrix operator+(const Matrix & mat) const {
-            Matrix out;
-            for (int i = 0; i < rows; i++) {
-                for (int j = 0; j < cols; j++) {
-                    out[i][j] = matrix[i][j] + mat[i][j];
-                }
-            }
-            return out;
+        constexpr T operator()(uint32_t i, uint32_t j) const {
+            return matrix[i][j];
         }
 
-        Matrix& operator+=(const Matrix &mat) {
-            *this = *this + mat;
+        template <MatrixExpression E> requires MatchingMatrixExpressions<Matrix, E>
+        constexpr Matrix& operator+=(const E &mat) {
+            if constexpr (has_kernels && std::is_same_v<E, Matrix>) {
+                if (!std::is_constant_evaluated()) {
+                    kernel_add(*this, mat, *this);
+                    return *this;
+                }
+            }
+            for (unsigned int i = 0; i < rows; i++) {
+                for (unsigned int j = 0; j < cols; j++) {
+                    matrix[i][j] += mat(i, j);
+                }
+            }
             return *this;
         }
 
-        Matrix operator-(const Matrix &mat) const {
-            Matrix out;
-            for (int i = 0; i < rows; i++) {
-                for (int j = 0; j < cols; j++) {
-                    out[i][j] = matrix[i][j] - mat[i][j];
+        template <MatrixExpression E> requires MatchingMatrixExpressions<Matrix, E>
+        constexpr Matrix& operator-=(const E &mat) {
+            if constexpr (has_kernels && std::is_same_v<E, Matrix>) {
+                if (!std::is_constant_evaluated()) {
+                    kernel_sub(*this, mat, *this);
+                    return *this;
+                }
+            }
+            for (unsigned int i = 0; i < rows; i++) {
+                for (unsigned int j = 0; j < cols; j++) {
+                    matrix[i][j] -= mat(i, j);
                 }
             }
-            return out;
-        }
-
-        Matrix& operator-=(const Matrix &mat) {
-            *this = *this - mat;
             return *this;
         }
 
-        Matrix operator*(T k) const {
-            Matrix out;
-            for (int i = 0; i < rows; i++) {
-                for (int j = 0; j < cols; j++) {
-                    out[i][j] = matrix[i][j] * k;
+        constexpr Matrix& operator*=(T k) {
+            if constexpr (has_kernels) {
+                if (!std::is_constant_evaluated()) {
+                    kernel_mul_by_k(*this, k, *this);
+                    return *this;
+                }
+            }
+            for (unsigned int i = 0; i < rows; i++) {
+                for (unsigned int j = 0; j < cols; j++) {
+                    matrix[i][j] *= k;
                 }
             }
-            return out;
-        }
-
-        Matrix& operator*=(T k) {
-            *this = *this * k;
             return *this;
         }
 
-        Matrix operator/(T k) const {
+        constexpr Matrix& operator/=(T k) {
             if (k == 0) {
-                return Matrix();
+                *this = Matrix();
+                return *this;
             }
-            Matrix out;
-            for (int i = 0; i < rows; i++) {
-                for (int j = 0; j < cols; j++) {
-                    out[i][j] = matrix[i][j] / k;
+            for (unsigned int i = 0; i < rows; i++) {
+                for (unsigned int j = 0; j < cols; j++) {
+                    matrix[i][j] /= k;
                 }
             }
-            return out;
-        }
-
-        Matrix& operator/=(T k) {
-            *this = *this / k;
             return *this;
         }
 
         template <unsigned int ncols>
-        Matrix<T, rows, ncols> operator*(const Matrix<T, cols, ncols> &mat) const {
-            Matrix<T, rows, ncols> out;
+        constexpr Matrix<T, rows, ncols, layout> operator*(const Matrix<T, cols, ncols, layout> &mat) const {
+            Matrix<T, rows, ncols, layout> out;
+            if constexpr (is_mat3f && ncols == 3) {
+                if (!std::is_constant_evaluated()) {
+                    kernels::get_matrix_kernels().matrix_mul(matrix, mat.matrix, out.matrix);
+                    return out;
+                }
+            }
+            if constexpr (is_mat3fa && ncols == 3) {
+                if (!std::is_constant_evaluated()) {
+                    kernels::get_matrix_kernels().matrix_padded_mul(matrix, mat.matrix, out.matrix);
+                    return out;
+                }
+            }
+            if constexpr (is_mat4f && ncols == 4) {
+                if (!std::is_constant_evaluated()) {
+                    kernels::get_matrix_kernels().matrix4_mul(matrix, mat.matrix, out.matrix);
+                    return out;
+                }
+            }
             for (int i = 0; i < rows; i++) {
                 for (int j = 0; j < ncols; j++) {
                     out[i][j] = 0.0f;
@@ -139,13 +266,19 @@ namespace EngineM {
             return out;
         }
 
-        Matrix& operator*=(const Matrix<T, cols, cols> &mat) {
+        constexpr Matrix& operator*=(const Matrix<T, cols, cols, layout> &mat) {
             *this = *this * mat;
             return *this;
         }
 
-        Vector<T, rows> operator*(const Vector<T, cols> &vec) const {
+        constexpr Vector<T, rows> operator*(const Vector<T, cols> &vec) const {
             Vector<T, rows> out;
+            if constexpr (is_mat4f) {
+                if (!std::is_constant_evaluated()) {
+                    kernels::get_matrix_kernels().matrix4_mul_vector(matrix, vec.data, out.data);
+                    return out;
+                }
+            }
 
             for (int i = 0; i < rows; i++) {
                 for (int j = 0; j < cols; j++) {
@@ -155,7 +288,7 @@ namespace EngineM {
             return out;
         }
 
-        bool operator==(const Matrix &mat) const {
+        constexpr bool operator==(const Matrix &mat) const {
             for (uint32_t i = 0; i < rows; i++) {
                 for (uint32_t j = 0; j < cols; j++) {
                     if (!equals(matrix[i][j], mat[i][j])) {
@@ -166,41 +299,55 @@ namespace EngineM {
             return true;
         }
 
-        bool operator!=(const Matrix &mat) const {
+        constexpr bool operator!=(const Matrix &mat) const {
             return !(*this == mat);
         }
 
-        [[nodiscard]] T determinant() const requires (rows == cols && rows == 1) {
+        [[nodiscard]] constexpr T determinant() const requires (rows == cols && rows == 1) {
             return matrix[0][0];
         }
 
-        [[nodiscard]] T determinant() const requires (rows == cols && rows == 2) {
+        [[nodiscard]] constexpr T determinant() const requires (rows == cols && rows == 2) {
             return matrix[0][0] * matrix[1][1] - matrix[0][1] * matrix[1][0];
         }
 
-        [[nodiscard]] T determinant() const requires (rows == cols && rows > 2) {
-            T det = 0;
-            int sign = 1;
-
-            for (unsigned int f = 0; f < cols; f++) {
-                Matrix<T, rows - 1, cols - 1> minor;
+        [[nodiscard]] constexpr T determinant() const requires (rows == cols && rows == 3) {
+            return matrix[0][0] * (matrix[1][1] * matrix[2][2] - matrix[1][2] * matrix[2][1])
+                 - matrix[0][1] * (matrix[1][0] * matrix[2][2] - matrix[1][2] * matrix[2][0])
+                 + matrix[0][2] * (matrix[1][0] * matrix[2][1] - matrix[1][1] * matrix[2][0]);
+        }
 
-                for (unsigned int i = 1; i < rows; i++) {
-                    unsigned int minor_col = 0;
-                    for (unsigned int j = 0; j < cols; j++) {
-                        if (j == f) continue;
-                        minor[i - 1][minor_col] = matrix[i][j];
-                        minor_col++;
-                    }
-                }
+        [[nodiscard]] constexpr T determinant() const requires (rows == cols && rows == 4) {
+            // Laplace expansion along the first two rows: the 2x2 minors of rows 0-1 paired
+            // with their complementary minors of rows 2-3.
+            const T s0 = matrix[0][0] * matrix[1][1] - matrix[1][0] * matrix[0][1];
+            const T s1 = matrix[0][0] * matrix[1][2] - matrix[1][0] * matrix[0][2];
+            const T s2 = matrix[0][0] * matrix[1][3] - matrix[1][0] * matrix[0][3];
+            const T s3 = matrix[0][1] * matrix[1][2] - matrix[1][1] * matrix[0][2];
+            const T s4 = matrix[0][1] * matrix[1][3] - matrix[1][1] * matrix[0][3];
+            const T s5 = matrix[0][2] * matrix[1][3] - matrix[1][2] * matrix[0][3];
+
+            const T c0 = matrix[2][0] * matrix[3][1] - matrix[3][0] * matrix[2][1];
+            const T c1 = matrix[2][0] * matrix[3][2] - matrix[3][0] * matrix[2][2];
+            const T c2 = matrix[2][0] * matrix[3][3] - matrix[3][0] * matrix[2][3];
+            const T c3 = matrix[2][1] * matrix[3][2] - matrix[3][1] * matrix[2][2];
+            const T c4 = matrix[2][1] * matrix[3][3] - matrix[3][1] * matrix[2][3];
+            const T c5 = matrix[2][2] * matrix[3][3] - matrix[3][2] * matrix[2][3];
+
+            return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        }
 
-                det += sign * matrix[0][f] * minor.determinant();
-                sign = -sign;
+        [[nodiscard]] constexpr T determinant() const requires (rows == cols && rows > 4) {
+            const LUDecomposition<T, rows> lu(*this);
+            if constexpr (std::is_floating_point_v<T>) {
+                return lu.determinant();
+            } else {
+                const auto det = lu.determinant();
+                return static_cast<T>(det < 0 ? det - 0.5 : det + 0.5);
             }
-            return det;
         }
 
-        [[nodiscard]] T cofactor(int p, int q) const requires (rows == cols) {
+        [[nodiscard]] constexpr T cofactor(int p, int q) const requires (rows == cols) {
             Matrix<T, rows - 1, cols - 1> minor;
             unsigned int rowIdx = 0;
             unsigned int colIdx = 0;
@@ -220,38 +367,169 @@ namespace EngineM {
             return sign * minor.determinant();
         }
 
-        bool getInverse(Matrix &mat) const requires (rows == cols) {
-            T det = determinant();
-            if (det == 0) {
-                return false;
-            }
-
-            if constexpr (rows == 1) {
-                mat[0][0] = 1 / det;
-                return true;
-            } else {
-                T invDet = static_cast<T>(1) / det;
-
+        // 2x2, 3x3 and 4x4 use the closed-form adjugate; larger matrices go through LUDecomposition.
+        constexpr bool getInverse(Matrix &mat) const requires (rows == cols) {
+            if constexpr (rows > 4) {
+                const LUDecomposition<T, rows> lu(*this);
+                Matrix<typename LUDecomposition<T, rows>::value_type, rows, cols> inv;
+                if (!lu.getInverse(inv)) {
+                    return false;
+                }
                 for (unsigned int i = 0; i < rows; i++) {
                     for (unsigned int j = 0; j < cols; j++) {
-                        // Get the cofactor of matrix[i][j]
-                        // Note the swap of indices (j, i) to perform the Transpose (Adjugate)
-                        mat[j][i] = cofactor(i, j) * invDet;
+                        mat[i][j] = static_cast<T>(inv[i][j]);
                     }
                 }
                 return true;
+            } else {
+                const T det = determinant();
+                if (det == 0) {
+                    return false;
+                }
+
+                if constexpr (rows == 1) {
+                    mat[0][0] = 1 / det;
+                    return true;
+                } else {
+                    const T invDet = static_cast<T>(1) / det;
+                    const T (&m)[rows][stride] = matrix;
+                    Matrix out;
+
+                    if constexpr (rows == 2) {
+                        out[0][0] = m[1][1];
+                        out[0][1] = -m[0][1];
+                        out[1][0] = -m[1][0];
+                        out[1][1] = m[0][0];
+                    } else if constexpr (rows == 3) {
+                        out[0][0] = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+                        out[0][1] = m[0][2] * m[2][1] - m[0][1] * m[2][2];
+                        out[0][2] = m[0][1] * m[1][2] - m[0][2] * m[1][1];
+                        out[1][0] = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+                        out[1][1] = m[0][0] * m[2][2] - m[0][2] * m[2][0];
+                        out[1][2] = m[0][2] * m[1][0] - m[0][0] * m[1][2];
+                        out[2][0] = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+                        out[2][1] = m[0][1] * m[2][0] - m[0][0] * m[2][1];
+                        out[2][2] = m[0][0] * m[1][1] - m[0][1] * m[1][0];
+                    } else {
+                        const T s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+                        const T s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+                        const T s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+                        const T s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+                        const T s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+                        const T s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+
+                        const T c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+                        const T c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+                        const T c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+                        const T c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+                        const T c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+                        const T c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+
+                        out[0][0] = m[1][1] * c5 - m[1][2] * c4 + m[1][3] * c3;
+                        out[0][1] = -m[0][1] * c5 + m[0][2] * c4 - m[0][3] * c3;
+                        out[0][2] = m[3][1] * s5 - m[3][2] * s4 + m[3][3] * s3;
+                        out[0][3] = -m[2][1] * s5 + m[2][2] * s4 - m[2][3] * s3;
+
+                        out[1][0] = -m[1][0] * c5 + m[1][2] * c2 - m[1][3] * c1;
+                        out[1][1] = m[0][0] * c5 - m[0][2] * c2 + m[0][3] * c1;
+                        out[1][2] = -m[3][0] * s5 + m[3][2] * s2 - m[3][3] * s1;
+                        out[1][3] = m[2][0] * s5 - m[2][2] * s2 + m[2][3] * s1;
+
+                        out[2][0] = m[1][0] * c4 - m[1][1] * c2 + m[1][3] * c0;
+                        out[2][1] = -m[0][0] * c4 + m[0][1] * c2 - m[0][3] * c0;
+                        out[2][2] = m[3][0] * s4 - m[3][1] * s2 + m[3][3] * s0;
+                        out[2][3] = -m[2][0] * s4 + m[2][1] * s2 - m[2][3] * s0;
+
+                        out[3][0] = -m[1][0] * c3 + m[1][1] * c1 - m[1][2] * c0;
+                        out[3][1] = m[0][0] * c3 - m[0][1] * c1 + m[0][2] * c0;
+                        out[3][2] = -m[3][0] * s3 + m[3][1] * s1 - m[3][2] * s0;
+                        out[3][3] = m[2][0] * s3 - m[2][1] * s1 + m[2][2] * s0;
+                    }
+
+                    mat = out * invDet;
+                    return true;
+                }
             }
         }
 
-        bool inverse() requires (rows == cols) {
+        // Solves Ax = b by LU factorisation. Returns false if A is singular.
+        constexpr bool solve(const Vector<T, rows> &b, Vector<T, cols> &x) const requires (rows == cols && std::is_floating_point_v<T>) {
+            return LUDecomposition<T, rows>(*this).solve(b, x);
+        }
+
+        // Solves Ax = b for symmetric positive-definite A. Only the lower triangle is read.
+        // Returns false if A is not positive definite.
+        bool solveCholesky(const Vector<T, rows> &b, Vector<T, cols> &x) const requires (rows == cols && std::is_floating_point_v<T>) {
+            return CholeskyDecomposition<T, rows>(*this).solve(b, x);
+        }
+
+        // Least-squares solution of Ax = b by Householder QR, exact when A is square.
+        // Returns false if A is rank deficient.
+        bool solveLeastSquares(const Vector<T, rows> &b, Vector<T, cols> &x) const requires (rows >= cols && std::is_floating_point_v<T>) {
+            return QRDecomposition<T, rows, cols>(*this).solve(b, x);
+        }
+
+        constexpr bool inverse() requires (rows == cols) {
             Matrix mat;
             const bool i = getInverse(mat);
             *this = mat;
             return i;
         }
 
-        [[nodiscard]] Matrix getTranspose() const {
+        // Inverse of an affine transform [R t; 0 1], skipping the general inverse.
+        // The bottom row is assumed to be (0, 0, 0, 1).
+        constexpr bool getAffineInverse(Matrix &mat) const requires (rows == cols && rows == 4) {
+            if constexpr (is_mat4f) {
+                if (!std::is_constant_evaluated()) {
+                    Matrix out;
+                    if (!kernels::get_matrix_kernels().matrix4_affine_inverse(matrix, out.matrix)) {
+                        return false;
+                    }
+                    mat = out;
+                    return true;
+                }
+            }
+
+            const T c00 = matrix[1][1] * matrix[2][2] - matrix[1][2] * matrix[2][1];
+            const T c01 = matrix[1][2] * matrix[2][0] - matrix[1][0] * matrix[2][2];
+            const T c02 = matrix[1][0] * matrix[2][1] - matrix[1][1] * matrix[2][0];
+
+            const T det = matrix[0][0] * c00 + matrix[0][1] * c01 + matrix[0][2] * c02;
+            if (det == 0) {
+                return false;
+            }
+
+            Matrix out;
+            out[0][0] = c00 / det;
+            out[0][1] = (matrix[0][2] * matrix[2][1] - matrix[0][1] * matrix[2][2]) / det;
+            out[0][2] = (matrix[0][1] * matrix[1][2] - matrix[0][2] * matrix[1][1]) / det;
+            out[1][0] = c01 / det;
+            out[1][1] = (matrix[0][0] * matrix[2][2] - matrix[0][2] * matrix[2][0]) / det;
+            out[1][2] = (matrix[0][2] * matrix[1][0] - matrix[0][0] * matrix[1][2]) / det;
+            out[2][0] = c02 / det;
+            out[2][1] = (matrix[0][1] * matrix[2][0] - matrix[0][0] * matrix[2][1]) / det;
+            out[2][2] = (matrix[0][0] * matrix[1][1] - matrix[0][1] * matrix[1][0]) / det;
+
+            for (unsigned int i = 0; i < 3; i++) {
+                out[i][3] = -(out[i][0] * matrix[0][3] + out[i][1] * matrix[1][3] + out[i][2] * matrix[2][3]);
+            }
+            out[3][3] = 1;
+            mat = out;
+            return true;
+        }
+
+        constexpr bool affineInverse() requires (rows == cols && rows == 4) {
+            return getAffineInverse(*this);
+        }
+
+        [[nodiscard]] constexpr Matrix getTranspose() const {
             Matrix m;
+            if constexpr (is_mat4f) {
+                if (!std::is_constant_evaluated()) {
+                    kernels::get_matrix_kernels().matrix4_transpose(matrix, m.matrix);
+                    return m;
+                }
+            }
 
             for (uint32_t i = 0; i < rows; i++) {
                 for (uint32_t j = 0; j < cols; j++) {
@@ -261,12 +539,12 @@ namespace EngineM {
             return m;
         }
 
-        Matrix& transpose() {
+        constexpr Matrix& transpose() {
             *this = getTranspose();
             return *this;
         }
 
-        static Matrix identity() requires (rows == cols) {
+        static constexpr Matrix identity() requires (rows == cols) {
             Matrix out;
             for (int i = 0; i < rows; i++) {
                 out[i][i] = 1;
@@ -277,6 +555,367 @@ namespace EngineM {
         ~Matrix() = default;
     };
 
+    // LU factorisation with partial pivoting, PA = LU, with the unit-diagonal L and U packed into
+    // one array. Factorise once and reuse it to solve for several right-hand sides. Integer
+    // matrices are factorised in double.
+    template <typename T, unsigned int n>
+    class LUDecomposition {
+    public:
+        using value_type = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+    private:
+        value_type lu[n][n] {};
+        unsigned int pivot[n] {};
+        int sign = 1;
+        // An exactly zero pivot: the determinant is zero and there is no inverse.
+        bool singular = false;
+        // A pivot at rounding-error level relative to its column: too close to singular to solve.
+        bool rankDeficient = false;
+
+        // std::abs is not constexpr for floating point before C++23.
+        static constexpr value_type magnitude(const value_type x) {
+            return x < 0 ? -x : x;
+        }
+
+    public:
+        template <Layout layout>
+        constexpr explicit LUDecomposition(const Matrix<T, n, n, layout> &mat) {
+            // Columns are never permuted, so pivot k is measured against the scale of column k
+            // and a badly scaled but nonsingular matrix is not mistaken for a rank deficient one.
+            value_type tolerance[n] {};
+            for (unsigned int i = 0; i < n; i++) {
+                pivot[i] = i;
+                for (unsigned int j = 0; j < n; j++) {
+                    lu[i][j] = static_cast<value_type>(mat[i][j]);
+                    tolerance[j] = std::max(tolerance[j], magnitude(lu[i][j]));
+                }
+            }
+            for (unsigned int j = 0; j < n; j++) {
+                tolerance[j] *= n * std::numeric_limits<value_type>::epsilon();
+            }
+
+            for (unsigned int k = 0; k < n; k++) {
+                unsigned int p = k;
+                for (unsigned int i = k + 1; i < n; i++) {
+                    if (magnitude(lu[i][k]) > magnitude(lu[p][k])) {
+                        p = i;
+                    }
+                }
+                if (magnitude(lu[p][k]) <= tolerance[k]) {
+                    rankDeficient = true;
+                }
+                if (lu[p][k] == 0) {
+                    singular = true;
+                    continue;
+                }
+                if (p != k) {
+                    for (unsigned int j = 0; j < n; j++) {
+                        const value_type tmp = lu[p][j];
+                        lu[p][j] = lu[k][j];
+                        lu[k][j] = tmp;
+                    }
+                    const unsigned int tmp = pivot[p];
+                    pivot[p] = pivot[k];
+                    pivot[k] = tmp;
+                    sign = -sign;
+                }
+
+                const value_type inv = 1 / lu[k][k];
+                for (unsigned int i = k + 1; i < n; i++) {
+                    const value_type l = lu[i][k] * inv;
+                    lu[i][k] = l;
+                    for (unsigned int j = k + 1; j < n; j++) {
+                        lu[i][j] -= l * lu[k][j];
+                    }
+                }
+            }
+        }
+
+        // True when some pivot is at rounding-error level, in which case solve refuses. The
+        // determinant and inverse are still computed unless a pivot is exactly zero.
+        [[nodiscard]] constexpr bool isSingular() const {
+            return rankDeficient;
+        }
+
+        // Row of the original matrix that ended up in row i.
+        [[nodiscard]] constexpr unsigned int getPivot(unsigned int i) const {
+            return pivot[i];
+        }
+
+        [[nodiscard]] constexpr Matrix<value_type, n, n> getLower() const {
+            Matrix<value_type, n, n> out;
+            for (unsigned int i = 0; i < n; i++) {
+                for (unsigned int j = 0; j < i; j++) {
+                    out[i][j] = lu[i][j];
+                }
+                out[i][i] = 1;
+            }
+            return out;
+        }
+
+        [[nodiscard]] constexpr Matrix<value_type, n, n> getUpper() const {
+            Matrix<value_type, n, n> out;
+            for (unsigned int i = 0; i < n; i++) {
+                for (unsigned int j = i; j < n; j++) {
+                    out[i][j] = lu[i][j];
+                }
+            }
+            return out;
+        }
+
+        [[nodiscard]] constexpr value_type determinant() const {
+            if (singular) {
+                return 0;
+            }
+            value_type det = sign;
+            for (unsigned int i = 0; i < n; i++) {
+                det *= lu[i][i];
+            }
+            return det;
+        }
+
+        // Solves Ax = b. Returns false if A is singular.
+        constexpr bool solve(const Vector<value_type, n> &b, Vector<value_type, n> &x) const {
+            if (rankDeficient) {
+                return false;
+            }
+            substitute(b, x);
+            return true;
+        }
+
+        // Solves AX = B column by column.
+        template <unsigned int m>
+        constexpr bool solve(const Matrix<value_type, n, m> &b, Matrix<value_type, n, m> &x) const {
+            if (rankDeficient) {
+                return false;
+            }
+            substitute(b, x);
+            return true;
+        }
+
+        // Like the closed-form sizes, fails only when the determinant is exactly zero.
+        constexpr bool getInverse(Matrix<value_type, n, n> &mat) const {
+            if (singular) {
+                return false;
+            }
+            substitute(Matrix<value_type, n, n>::identity(), mat);
+            return true;
+        }
+
+    private:
+        constexpr void substitute(const Vector<value_type, n> &b, Vector<value_type, n> &x) const {
+            Vector<value_type, n> y;
+            for (unsigned int i = 0; i < n; i++) {
+                value_type sum = b[pivot[i]];
+                for (unsigned int j = 0; j < i; j++) {
+                    sum -= lu[i][j] * y[j];
+                }
+                y[i] = sum;
+            }
+            for (unsigned int i = n; i-- > 0;) {
+                value_type sum = y[i];
+                for (unsigned int j = i + 1; j < n; j++) {
+                    sum -= lu[i][j] * y[j];
+                }
+                y[i] = sum / lu[i][i];
+            }
+            x = y;
+        }
+
+        template <unsigned int m>
+        constexpr void substitute(const Matrix<value_type, n, m> &b, Matrix<value_type, n, m> &x) const {
+            Matrix<value_type, n, m> out;
+            for (unsigned int c = 0; c < m; c++) {
+                Vector<value_type, n> column;
+                for (unsigned int i = 0; i < n; i++) {
+                    column[i] = b[i][c];
+                }
+                substitute(column, column);
+                for (unsigned int i = 0; i < n; i++) {
+                    out[i][c] = column[i];
+                }
+            }
+            x = out;
+        }
+    };
+
+    // Cholesky factorisation A = LL^T of a symmetric positive-definite matrix. Only the lower
+    // triangle of A is read.
+    template <typename T, unsigned int n>
+    class CholeskyDecomposition {
+        static_assert(std::is_floating_point_v<T>, "Cholesky decomposition requires a floating point type");
+
+        T l[n][n] {};
+        bool positiveDefinite = true;
+
+    public:
+        template <Layout layout>
+        explicit CholeskyDecomposition(const Matrix<T, n, n, layout> &mat) {
+            for (unsigned int j = 0; j < n; j++) {
+                T d = mat[j][j];
+                for (unsigned int k = 0; k < j; k++) {
+                    d -= l[j][k] * l[j][k];
+                }
+                if (!(d > 0)) {
+                    positiveDefinite = false;
+                    return;
+                }
+                l[j][j] = std::sqrt(d);
+
+                const T inv = 1 / l[j][j];
+                for (unsigned int i = j + 1; i < n; i++) {
+                    T sum = mat[i][j];
+                    for (unsigned int k = 0; k < j; k++) {
+                        sum -= l[i][k] * l[j][k];
+                    }
+                    l[i][j] = sum * inv;
+                }
+            }
+        }
+
+        [[nodiscard]] bool isPositiveDefinite() const {
+            return positiveDefinite;
+        }
+
+        [[nodiscard]] Matrix<T, n, n> getLower() const {
+            return Matrix<T, n, n>(l);
+        }
+
+        // Solves Ax = b. Returns false if A is not positive definite.
+        bool solve(const Vector<T, n> &b, Vector<T, n> &x) const {
+            if (!positiveDefinite) {
+                return false;
+            }
+            Vector<T, n> y;
+            for (unsigned int i = 0; i < n; i++) {
+                T sum = b[i];
+                for (unsigned int k = 0; k < i; k++) {
+                    sum -= l[i][k] * y[k];
+                }
+                y[i] = sum / l[i][i];
+            }
+            for (unsigned int i = n; i-- > 0;) {
+                T sum = y[i];
+                for (unsigned int k = i + 1; k < n; k++) {
+                    sum -= l[k][i] * y[k];
+                }
+                y[i] = sum / l[i][i];
+            }
+            x = y;
+            return true;
+        }
+    };
+
+    // Householder QR factorisation of a rows x cols matrix with rows >= cols. The Householder
+    // vectors are kept below the diagonal and R's diagonal separately, so Q is never formed.
+    template <typename T, unsigned int rows, unsigned int cols>
+    class QRDecomposition {
+        static_assert(std::is_floating_point_v<T>, "QR decomposition requires a floating point type");
+        static_assert(rows >= cols, "QR decomposition requires at least as many rows as columns");
+
+        T qr[rows][cols] {};
+        T rdiag[cols] {};
+        bool fullRank = true;
+
+    public:
+        template <Layout layout>
+        explicit QRDecomposition(const Matrix<T, rows, cols, layout> &mat) {
+            T scale = 0;
+            for (unsigned int i = 0; i < rows; i++) {
+                for (unsigned int j = 0; j < cols; j++) {
+                    qr[i][j] = mat[i][j];
+                    scale = std::max(scale, std::abs(qr[i][j]));
+                }
+            }
+            const T tolerance = scale * rows * std::numeric_limits<T>::epsilon();
+
+            for (unsigned int k = 0; k < cols; k++) {
+                T norm = 0;
+                for (unsigned int i = k; i < rows; i++) {
+                    norm = std::hypot(norm, qr[i][k]);
+                }
+                if (norm <= tolerance) {
+                    rdiag[k] = 0;
+                    fullRank = false;
+                    continue;
+                }
+                if (qr[k][k] < 0) {
+                    norm = -norm;
+                }
+                for (unsigned int i = k; i < rows; i++) {
+                    qr[i][k] /= norm;
+                }
+                qr[k][k] += 1;
+
+                for (unsigned int j = k + 1; j < cols; j++) {
+                    T s = 0;
+                    for (unsigned int i = k; i < rows; i++) {
+                        s += qr[i][k] * qr[i][j];
+                    }
+                    s = -s / qr[k][k];
+                    for (unsigned int i = k; i < rows; i++) {
+                        qr[i][j] += s * qr[i][k];
+                    }
+                }
+                rdiag[k] = -norm;
+            }
+        }
+
+        [[nodiscard]] bool isFullRank() const {
+            return fullRank;
+        }
+
+        [[nodiscard]] Matrix<T, cols, cols> getR() const {
+            Matrix<T, cols, cols> out;
+            for (unsigned int i = 0; i < cols; i++) {
+                out[i][i] = rdiag[i];
+                for (unsigned int j = i + 1; j < cols; j++) {
+                    out[i][j] = qr[i][j];
+                }
+            }
+            return out;
+        }
+
+        // Minimises |Ax - b|. Returns false if A is rank deficient.
+        bool solve(const Vector<T, rows> &b, Vector<T, cols> &x) const {
+            if (!fullRank) {
+                return false;
+            }
+            Vector<T, rows> y = b;
+            for (unsigned int k = 0; k < cols; k++) {
+                T s = 0;
+                for (unsigned int i = k; i < rows; i++) {
+                    s += qr[i][k] * y[i];
+                }
+                s = -s / qr[k][k];
+                for (unsigned int i = k; i < rows; i++) {
+                    y[i] += s * qr[i][k];
+                }
+            }
+            for (unsigned int k = cols; k-- > 0;) {
+                y[k] /= rdiag[k];
+                for (unsigned int i = 0; i < k; i++) {
+                    y[i] -= y[k] * qr[i][k];
+                }
+            }
+            for (unsigned int i = 0; i < cols; i++) {
+                x[i] = y[i];
+            }
+            return true;
+        }
+    };
+
+    // Products with an expression operand evaluate it first; only element-wise arithmetic is lazy.
+    template <MatrixExpression L, MatrixExpression R> requires (std::is_same_v<typename L::value_type, typename R::value_type> && L::col_count == R::row_count && (!L::is_leaf || !R::is_leaf))
+    [[nodiscard]] constexpr auto operator*(const L &lhs, const R &rhs) {
+        return typename L::matrix_type(lhs) * typename R::matrix_type(rhs);
+    }
+
+    template <MatrixExpression E, typename T, unsigned int n> requires (std::is_same_v<typename E::value_type, T> && E::col_count == n && !E::is_leaf)
+    [[nodiscard]] constexpr Vector<T, E::row_count> operator*(const E &mat, const Vector<T, n> &vec) {
+        return typename E::matrix_type(mat) * vec;
+    }
+
     using mat2 = Matrix<int, 2, 2>;
     using mat2x3 = Matrix<int, 2, 3>;
     using mat2x4 = Matrix<int, 2, 4>;
@@ -301,6 +940,9 @@ namespace EngineM {
     using mat4x3f = Matrix<float, 4, 3>;
     using mat4f = Matrix<float, 4, 4>;
 
+    using mat3fa = Matrix<float, 3, 3, Layout::Padded>;
+    using mat4fa = Matrix<float, 4, 4, Layout::Padded>;
+
     using mat2d = Matrix<double, 2, 2>;
     using mat2x3d = Matrix<double, 2, 3>;
     using mat2x4d = Matrix<double, 2, 4>;
@@ -313,4 +955,7 @@ namespace EngineM {
     using mat4x3d = Matrix<double, 4, 3>;
     using mat4d = Matrix<double, 4, 4>;
 
+    static_assert(std::is_trivially_copyable_v<mat3f> && sizeof(mat3f) == 9 * sizeof(float));
+    static_assert(std::is_trivially_copyable_v<mat4fa> && sizeof(mat4fa) == 16 * sizeof(float));
+
 }
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "engine-m/core.h"
+#include "engine-m/aligned_buffer.h"
+#include "engine-m/matrix/matrix.h"
+
+namespace EngineM {
+
+    // Structure-of-arrays storage for mat3f: each of the 9 elements lives in its own
+    // 32-byte aligned stream, padded to a multiple of 8 lanes.
+    class ENGINE_M_API MatrixArray {
+        size_t count = 0;
+        size_t stride = 0;
+        AlignedBuffer buffer;
+
+    public:
+        static constexpr size_t alignment = AlignedBuffer::alignment;
+        static constexpr size_t lanes = alignment / sizeof(float);
+
+        MatrixArray() = default;
+        explicit MatrixArray(size_t);
+        explicit MatrixArray(std::span<const mat3f>);
+        MatrixArray(const MatrixArray &) = default;
+        MatrixArray(MatrixArray &&) noexcept;
+
+        MatrixArray& operator=(const MatrixArray &);
+        MatrixArray& operator=(MatrixArray &&) noexcept;
+
+        [[nodiscard]] size_t size() const;
+        [[nodiscard]] size_t getStride() const;
+
+        float* stream(uint32_t, uint32_t);
+        [[nodiscard]] const float* stream(uint32_t, uint32_t) const;
+
+        [[nodiscard]] mat3f get(size_t) const;
+        void set(size_t, const mat3f &);
+
+        void toMatrices(std::span<mat3f>) const;
+
+        MatrixArray operator+(const MatrixArray &) const;
+        MatrixArray& operator+=(const MatrixArray &);
+
+        MatrixArray operator-(const MatrixArray &) const;
+        MatrixArray& operator-=(const MatrixArray &);
+
+        MatrixArray operator*(float) const;
+        MatrixArray& operator*=(float);
+
+        MatrixArray operator*(const MatrixArray &) const;
+        MatrixArray& operator*=(const MatrixArray &);
+
+    };
+
+    // Batched mat3f arithmetic over array-of-matrices spans. All spans must be the same
+    // length; out may alias either input.
+    ENGINE_M_API void addBatch(std::span<const mat3f>, std::span<const mat3f>, std::span<mat3f>);
+    ENGINE_M_API void subBatch(std::span<const mat3f>, std::span<const mat3f>, std::span<mat3f>);
+    ENGINE_M_API void mulBatch(std::span<const mat3f>, float, std::span<mat3f>);
+    ENGINE_M_API void mulBatch(std::span<const mat3f>, std::span<const mat3f>, std::span<mat3f>);
+}
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <array>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace EngineM {
+
+    // Element-wise Matrix arithmetic (+, -, scalar * and /) builds these lightweight nodes
+    // instead of temporaries. The whole expression is evaluated in a single loop when it is
+    // assigned to a Matrix, or with eval(). Named matrices are held by reference and
+    // temporaries by value, so an expression must not outlive the named matrices it was built
+    // from. Nodes also answer the read-only Matrix interface (rows, determinant, inverse,
+    // transpose, comparison) by evaluating themselves first.
+    template <typename E>
+    concept MatrixExpression = std::remove_cvref_t<E>::is_matrix_expression;
+
+    // How a node stores an operand passed as E&&: a reference to a named matrix, a copy of
+    // anything else.
+    template <typename E>
+    using matrix_operand = std::conditional_t<std::is_lvalue_reference_v<E> && std::remove_cvref_t<E>::is_leaf, const std::remove_cvref_t<E> &, std::remove_cvref_t<E>>;
+
+    template <typename L, typename R>
+    concept MatchingMatrixExpressions = MatrixExpression<L> && MatrixExpression<R> &&
+        std::is_same_v<typename std::remove_cvref_t<L>::value_type, typename std::remove_cvref_t<R>::value_type> &&
+        std::remove_cvref_t<L>::row_count == std::remove_cvref_t<R>::row_count &&
+        std::remove_cvref_t<L>::col_count == std::remove_cvref_t<R>::col_count;
+
+    // Matrix division by zero yields the zero matrix.
+    struct DividesOrZero {
+        template <typename T>
+        constexpr T operator()(const T a, const T k) const {
+            return k == 0 ? T() : a / k;
+        }
+    };
+
+    template <typename Derived>
+    class MatrixExpressionBase {
+        constexpr const Derived& self() const {
+            return static_cast<const Derived &>(*this);
+        }
+
+    public:
+        // Row i by value, so (a + b)[i][j] reads like a Matrix element.
+        constexpr auto operator[](unsigned int i) const {
+            std::array<typename Derived::value_type, Derived::col_count> row {};
+            for (unsigned int j = 0; j < Derived::col_count; j++) {
+                row[j] = self()(i, j);
+            }
+            return row;
+        }
+
+        [[nodiscard]] constexpr auto determinant() const {
+            return self().eval().determinant();
+        }
+
+        [[nodiscard]] constexpr auto cofactor(int p, int q) const {
+            return self().eval().cofactor(p, q);
+        }
+
+        template <typename M>
+        constexpr bool getInverse(M &mat) const {
+            return self().eval().getInverse(mat);
+        }
+
+        [[nodiscard]] constexpr auto getTranspose() const {
+            return self().eval().getTranspose();
+        }
+
+        // An expression cannot be transposed in place, so this returns the transpose.
+        [[nodiscard]] constexpr auto transpose() const {
+            return self().eval().getTranspose();
+        }
+
+        template <MatrixExpression M> requires MatchingMatrixExpressions<Derived, M>
+        constexpr bool operator==(const M &mat) const {
+            return self().eval() == typename Derived::matrix_type(mat);
+        }
+
+        template <MatrixExpression M> requires MatchingMatrixExpressions<Derived, M>
+        constexpr bool operator!=(const M &mat) const {
+            return !(*this == mat);
+        }
+    };
+
+    template <typename Op, typename L, typename R>
+    class MatrixBinary : public MatrixExpressionBase<MatrixBinary<Op, L, R>> {
+        L lhs;
+        R rhs;
+
+    public:
+        using operation = Op;
+        using left_type = std::remove_cvref_t<L>;
+        using right_type = std::remove_cvref_t<R>;
+        using value_type = typename left_type::value_type;
+        using matrix_type = typename left_type::matrix_type;
+        static constexpr unsigned int row_count = left_type::row_count;
+        static constexpr unsigned int col_count = left_type::col_count;
+        static constexpr bool is_matrix_expression = true;
+        static constexpr bool is_leaf = false;
+
+        template <typename A, typename B>
+        constexpr MatrixBinary(A &&lhs, B &&rhs): lhs(std::forward<A>(lhs)), rhs(std::forward<B>(rhs)) {
+
+        }
+
+        constexpr const left_type& left() const {
+            return lhs;
+        }
+
+        constexpr const right_type& right() const {
+            return rhs;
+        }
+
+        constexpr value_type operator()(unsigned int i, unsigned int j) const {
+            return Op{}(lhs(i, j), rhs(i, j));
+        }
+
+        [[nodiscard]] constexpr matrix_type eval() const {
+            return matrix_type(*this);
+        }
+    };
+
+    template <typename Op, typename E>
+    class MatrixScalar : public MatrixExpressionBase<MatrixScalar<Op, E>> {
+        E operand;
+        typename std::remove_cvref_t<E>::value_type k;
+
+    public:
+        using operation = Op;
+        using left_type = std::remove_cvref_t<E>;
+        using value_type = typename left_type::value_type;
+        using matrix_type = typename left_type::matrix_type;
+        static constexpr unsigned int row_count = left_type::row_count;
+        static constexpr unsigned int col_count = left_type::col_count;
+        static constexpr bool is_matrix_expression = true;
+        static constexpr bool is_leaf = false;
+
+        template <typename A>
+        constexpr MatrixScalar(A &&operand, value_type k): operand(std::forward<A>(operand)), k(k) {
+
+        }
+
+        constexpr const left_type& left() const {
+            return operand;
+        }
+
+        constexpr value_type scalar() const {
+            return k;
+        }
+
+        constexpr value_type operator()(unsigned int i, unsigned int j) const {
+            return Op{}(operand(i, j), k);
+        }
+
+        [[nodiscard]] constexpr matrix_type eval() const {
+            return matrix_type(*this);
+        }
+    };
+
+    // True when E is exactly `a op b` or `a op k` over two matrices of type M, which the
+    // kernel-backed types hand straight to their SIMD kernels.
+    template <typename Op, typename E, typename M>
+    inline constexpr bool is_matrix_binary_of = false;
+
+    template <typename Op, typename L, typename R, typename M>
+    inline constexpr bool is_matrix_binary_of<Op, MatrixBinary<Op, L, R>, M> =
+        std::is_same_v<std::remove_cvref_t<L>, M> && std::is_same_v<std::remove_cvref_t<R>, M>;
+
+    template <typename Op, typename E, typename M>
+    inline constexpr bool is_matrix_scalar_of = false;
+
+    template <typename Op, typename E, typename M>
+    inline constexpr bool is_matrix_scalar_of<Op, MatrixScalar<Op, E>, M> = std::is_same_v<std::remove_cvref_t<E>, M>;
+
+    template <typename L, typename R> requires MatchingMatrixExpressions<L, R>
+    [[nodiscard]] constexpr MatrixBinary<std::plus<>, matrix_operand<L>, matrix_operand<R>> operator+(L &&lhs, R &&rhs) {
+        return {std::forward<L>(lhs), std::forward<R>(rhs)};
+    }
+
+    template <typename L, typename R> requires MatchingMatrixExpressions<L, R>
+    [[nodiscard]] constexpr MatrixBinary<std::minus<>, matrix_operand<L>, matrix_operand<R>> operator-(L &&lhs, R &&rhs) {
+        return {std::forward<L>(lhs), std::forward<R>(rhs)};
+    }
+
+    template <MatrixExpression E>
+    [[nodiscard]] constexpr MatrixScalar<std::multiplies<>, matrix_operand<E>> operator*(E &&mat, typename std::remove_cvref_t<E>::value_type k) {
+        return {std::forward<E>(mat), k};
+    }
+
+    template <MatrixExpression E>
+    [[nodiscard]] constexpr MatrixScalar<DividesOrZero, matrix_operand<E>> operator/(E &&mat, typename std::remove_cvref_t<E>::value_type k) {
+        return {std::forward<E>(mat), k};
+    }
+}
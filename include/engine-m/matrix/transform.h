@@ -0,0 +1,19 @@
+#pragma once
+
+#include <span>
+
+#include "engine-m/core.h"
+#include "engine-m/matrix/matrix.h"
+#include "engine-m/vector/vector.h"
+
+namespace EngineM {
+
+    // Bulk point transforms writing into caller-owned buffers. A mat4f is treated as an
+    // affine transform: its bottom row is ignored and the translation column is applied.
+    // Input and output may be the same buffer.
+    ENGINE_M_API void transformPoints(const mat3f &, std::span<const vec3f>, std::span<vec3f>);
+    ENGINE_M_API void transformPoints(const mat4f &, std::span<const vec3f>, std::span<vec3f>);
+
+    ENGINE_M_API void transformPoints(const mat3f &, std::span<const float>, std::span<const float>, std::span<const float>, std::span<float>, std::span<float>, std::span<float>);
+    ENGINE_M_API void transformPoints(const mat4f &, std::span<const float>, std::span<const float>, std::span<const float>, std::span<float>, std::span<float>, std::span<float>);
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <type_traits>
+
+#include "engine-m/core.h"
+#include "engine-m/quaternion/quaternion.h"
+#include "engine-m/vector/vector.h"
+
+namespace EngineM {
+
+    // real + ε dual with ε² = 0. A unit dual quaternion encodes a rigid transform: real is
+    // the rotation and dual = 0.5 (0, t) real for the translation t applied after it.
+    class ENGINE_M_API DualQuaternion {
+    public:
+        Quaternion real;
+        Quaternion dual;
+
+        constexpr DualQuaternion() = default;
+
+        constexpr DualQuaternion(const Quaternion &real, const Quaternion &dual): real(real), dual(dual) {
+
+        }
+
+        // Rotation by a unit quaternion followed by a translation.
+        constexpr DualQuaternion(const Quaternion &rotation, const vec3f &translation): real(rotation), dual(Quaternion(0, translation) * rotation * 0.5f) {
+
+        }
+
+        constexpr DualQuaternion(const DualQuaternion &) = default;
+
+        constexpr DualQuaternion& operator=(const DualQuaternion &) = default;
+
+        constexpr DualQuaternion operator+(const DualQuaternion &q) const {
+            return {real + q.real, dual + q.dual};
+        }
+
+        constexpr DualQuaternion& operator+=(const DualQuaternion &q) {
+            return *this = *this + q;
+        }
+
+        constexpr DualQuaternion operator-(const DualQuaternion &q) const {
+            return {real - q.real, dual - q.dual};
+        }
+
+        constexpr DualQuaternion& operator-=(const DualQuaternion &q) {
+            return *this = *this - q;
+        }
+
+        // Composition: (p * q) applies q first, then p.
+        constexpr DualQuaternion operator*(const DualQuaternion &q) const {
+            return {real * q.real, real * q.dual + dual * q.real};
+        }
+
+        constexpr DualQuaternion& operator*=(const DualQuaternion &q) {
+            return *this = *this * q;
+        }
+
+        constexpr DualQuaternion operator*(const float k) const {
+            return {real * k, dual * k};
+        }
+
+        constexpr DualQuaternion& operator*=(const float k) {
+            return *this = *this * k;
+        }
+
+        constexpr bool operator==(const DualQuaternion &q) const {
+            return real == q.real && dual == q.dual;
+        }
+
+        constexpr bool operator!=(const DualQuaternion &q) const {
+            return !(*this == q);
+        }
+
+        // Inverse of a unit dual quaternion.
+        [[nodiscard]] constexpr DualQuaternion conjugate() const {
+            return {real.conjugate(), dual.conjugate()};
+        }
+
+        [[nodiscard]] constexpr vec3f getTranslation() const {
+            return (dual * real.conjugate()).v * 2;
+        }
+
+        [[nodiscard]] constexpr vec3f transformPoint(const vec3f &p) const {
+            return real.rotate(p) + getTranslation();
+        }
+
+        [[nodiscard]] constexpr vec3f transformVector(const vec3f &v) const {
+            return real.rotate(v);
+        }
+
+        // Scales both parts by 1 / |real|, leaving a zero real part unchanged.
+        void normalise();
+
+        ~DualQuaternion() = default;
+    };
+
+    static_assert(std::is_trivially_copyable_v<DualQuaternion> && sizeof(DualQuaternion) == 32);
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <span>
+
+#include "engine-m/core.h"
+#include "engine-m/quaternion/quaternion.h"
+
+namespace EngineM {
+
+    // Interpolation between unit quaternions along the shorter arc: b is negated when the
+    // two are more than 90 degrees apart.
+    ENGINE_M_API Quaternion nlerp(const Quaternion &, const Quaternion &, float);
+    ENGINE_M_API Quaternion slerp(const Quaternion &, const Quaternion &, float);
+
+    // slerp with the weights sin(t θ) / sin θ replaced by a polynomial in cos θ, which needs
+    // no acos or sin and stays within 2e-5 of the exact weights.
+    ENGINE_M_API Quaternion slerpFast(const Quaternion &, const Quaternion &, float);
+
+    // Batched interpolation of a[i] towards b[i] by t[i]. All spans must be the same size;
+    // out may alias a or b. nlerp and slerpFast run through the SIMD kernels, slerp is exact
+    // and evaluates the trigonometry per pair.
+    ENGINE_M_API void nlerp(std::span<const Quaternion>, std::span<const Quaternion>, std::span<const float>, std::span<Quaternion>);
+    ENGINE_M_API void slerp(std::span<const Quaternion>, std::span<const Quaternion>, std::span<const float>, std::span<Quaternion>);
+    ENGINE_M_API void slerpFast(std::span<const Quaternion>, std::span<const Quaternion>, std::span<const float>, std::span<Quaternion>);
+}
@@ -1,45 +1,165 @@
 #pragma once
 
+#include <type_traits>
+
 #include "engine-m/core.h"
+#include "engine-m/utils.h"
 #include "engine-m/vector/vector.h"
 
 namespace EngineM {
     
-    class ENGINE_M_API Quaternion {
+    // v is stored before a and the whole quaternion is 16-byte aligned, so (x, y, z, a)
+    // loads into a single SSE register outside constant evaluation.
+    class ENGINE_M_API alignas(16) Quaternion {
+#ifdef ENGINE_M_HAS_SSE
+        explicit Quaternion(const __m128 q) {
+            _mm_store_ps(data(), q);
+        }
+
+        [[nodiscard]] __m128 simd() const {
+            return _mm_load_ps(data());
+        }
+#endif
+
     public:
-        float a {};
         vec3f v;
+        float a {};
+
+        // The four floats (x, y, z, a) in memory order, as the quaternion kernels expect them.
+        [[nodiscard]] float* data() {
+            return reinterpret_cast<float *>(this);
+        }
+
+        [[nodiscard]] const float* data() const {
+            return reinterpret_cast<const float *>(this);
+        }
+
+        constexpr Quaternion() = default;
+
+        constexpr Quaternion(const float a, const vec3f &v): v(v), a(a) {
+
+        }
 
-        Quaternion() = default;
-        Quaternion(float, const vec3f &);
-        Quaternion(const Quaternion &) = default;
+        constexpr Quaternion(const Quaternion &) = default;
 
-        Quaternion& operator=(const Quaternion &) = default;
+        constexpr Quaternion& operator=(const Quaternion &) = default;
 
-        Quaternion operator+(const Quaternion &) const;
-        Quaternion& operator+=(const Quaternion &);
+        constexpr Quaternion operator+(const Quaternion &q) const {
+#ifdef ENGINE_M_HAS_SSE
+            if (!std::is_constant_evaluated()) {
+                return Quaternion(_mm_add_ps(simd(), q.simd()));
+            }
+#endif
+            return {a + q.a, v + q.v};
+        }
 
-        Quaternion operator-(const Quaternion &) const;
-        Quaternion& operator-=(const Quaternion &);
+        constexpr Quaternion& operator+=(const Quaternion &q) {
+            return *this = *this + q;
+        }
 
-        Quaternion operator*(const Quaternion &) const;
-        Quaternion& operator*=(const Quaternion &);
+        constexpr Quaternion operator-(const Quaternion &q) const {
+#ifdef ENGINE_M_HAS_SSE
+            if (!std::is_constant_evaluated()) {
+                return Quaternion(_mm_sub_ps(simd(), q.simd()));
+            }
+#endif
+            return {a - q.a, v - q.v};
+        }
 
-        Quaternion operator*(float) const;
-        Quaternion& operator*=(float);
+        constexpr Quaternion& operator-=(const Quaternion &q) {
+            return *this = *this - q;
+        }
 
-        Quaternion operator/(float) const;
-        Quaternion& operator/=(float);
+        constexpr Quaternion operator*(const Quaternion &q) const {
+#ifdef ENGINE_M_HAS_SSE
+            if (!std::is_constant_evaluated()) {
+                // Each lane of this scales a signed permutation of q.
+                const __m128 p = simd();
+                const __m128 r = q.simd();
+                const __m128 x = _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(0, 0, 0, 0)), _mm_xor_ps(_mm_shuffle_ps(r, r, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f)));
+                const __m128 y = _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(1, 1, 1, 1)), _mm_xor_ps(_mm_shuffle_ps(r, r, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f)));
+                const __m128 z = _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 2, 2, 2)), _mm_xor_ps(_mm_shuffle_ps(r, r, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f)));
+                const __m128 w = _mm_mul_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(3, 3, 3, 3)), r);
+                return Quaternion(_mm_add_ps(_mm_add_ps(x, y), _mm_add_ps(z, w)));
+            }
+#endif
+            // Summed in the same order as the SSE path so both give identical results.
+            const float (&p)[3] = v.data;
+            const float (&r)[3] = q.v.data;
+            return {
+                (a * q.a - p[2] * r[2]) - (p[0] * r[0] + p[1] * r[1]),
+                {
+                    (p[0] * q.a + p[1] * r[2]) + (a * r[0] - p[2] * r[1]),
+                    (p[1] * q.a - p[0] * r[2]) + (p[2] * r[0] + a * r[1]),
+                    (p[0] * r[1] - p[1] * r[0]) + (p[2] * q.a + a * r[2])
+                }
+            };
+        }
 
-        bool operator==(const Quaternion &) const;
-        bool operator!=(const Quaternion &) const;
+        constexpr Quaternion& operator*=(const Quaternion &q) {
+            return *this = *this * q;
+        }
+
+        constexpr Quaternion operator*(const float k) const {
+#ifdef ENGINE_M_HAS_SSE
+            if (!std::is_constant_evaluated()) {
+                return Quaternion(_mm_mul_ps(simd(), _mm_set1_ps(k)));
+            }
+#endif
+            return {a * k, v * k};
+        }
+
+        constexpr Quaternion& operator*=(const float k) {
+            return *this = *this * k;
+        }
+
+        constexpr Quaternion operator/(const float k) const {
+#ifdef ENGINE_M_HAS_SSE
+            if (!std::is_constant_evaluated()) {
+                return Quaternion(_mm_div_ps(simd(), _mm_set1_ps(k)));
+            }
+#endif
+            return {a / k, v / k};
+        }
+
+        constexpr Quaternion& operator/=(const float k) {
+            return *this = *this / k;
+        }
+
+        constexpr bool operator==(const Quaternion &q) const {
+            return equals(a, q.a) && v == q.v;
+        }
+
+        constexpr bool operator!=(const Quaternion &q) const {
+            return !(*this == q);
+        }
 
         [[nodiscard]] float norm() const;
         void normalise();
 
-        [[nodiscard]] Quaternion conjugate() const;
-        [[nodiscard]] Quaternion inverse() const;
+        [[nodiscard]] constexpr Quaternion conjugate() const {
+#ifdef ENGINE_M_HAS_SSE
+            if (!std::is_constant_evaluated()) {
+                return Quaternion(_mm_xor_ps(simd(), _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f)));
+            }
+#endif
+            return {a, v * -1};
+        }
+
+        [[nodiscard]] constexpr Quaternion inverse() const {
+            Quaternion conj = conjugate();
+            return conj /= (a * a + v * v);
+        }
+
+        // Rotates p by this unit quaternion as p + a t + v x t with t = 2 (v x p), which
+        // is equivalent to q * (0, p) * q^-1 without the two Hamilton products.
+        [[nodiscard]] constexpr vec3f rotate(const vec3f &p) const {
+            const vec3f t = (v ^ p) * 2;
+            return p + t * a + (v ^ t);
+        }
 
         ~Quaternion() = default;
     };
+
+    static_assert(std::is_trivially_copyable_v<Quaternion> && sizeof(Quaternion) == 16 && alignof(Quaternion) == 16);
 }
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <span>
+
+#include "engine-m/core.h"
+#include "engine-m/matrix/matrix.h"
+#include "engine-m/quaternion/quaternion.h"
+#include "engine-m/vector/vector.h"
+
+namespace EngineM {
+
+    // Rotation matrix of a unit quaternion, acting on column vectors. toMatrix4 adds a zero
+    // translation and (0, 0, 0, 1) bottom row.
+    ENGINE_M_API mat3f toMatrix(const Quaternion &);
+    ENGINE_M_API mat4f toMatrix4(const Quaternion &);
+
+    // Unit quaternion of a rotation matrix (the upper 3x3 of a mat4f), using Shepperd's method:
+    // the square root is taken of the largest of the four diagonal combinations, so it never
+    // divides by a small number.
+    ENGINE_M_API Quaternion fromMatrix(const mat3f &);
+    ENGINE_M_API Quaternion fromMatrix(const mat4f &);
+
+    // Batched toMatrix into packed matrices, e.g. for upload. A mat3x4f gets a zero
+    // translation column. Spans must be the same size.
+    ENGINE_M_API void toMatrices(std::span<const Quaternion>, std::span<mat3f>);
+    ENGINE_M_API void toMatrices(std::span<const Quaternion>, std::span<mat3x4f>);
+
+    // Bulk rotations by unit quaternions, writing into caller-owned buffers. Spans must be
+    // the same size; input and output may be the same buffer.
+    ENGINE_M_API void rotatePoints(const Quaternion &, std::span<const vec3f>, std::span<vec3f>);
+
+    // Rotates each point by the quaternion at the same index.
+    ENGINE_M_API void rotatePoints(std::span<const Quaternion>, std::span<const vec3f>, std::span<vec3f>);
+}
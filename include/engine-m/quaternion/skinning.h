@@ -0,0 +1,24 @@
+#pragma once
+
+#include <span>
+
+#include "engine-m/core.h"
+#include "engine-m/quaternion/dual_quaternion.h"
+#include "engine-m/vector/vec3_array.h"
+#include "engine-m/vector/vector.h"
+
+namespace EngineM {
+
+    // Dual quaternion linear blend skinning. Each vertex is influenced by the four bones in
+    // joints, weighted by weights; unused slots take a zero weight, and the weights of a vertex
+    // must not all be zero. The blended dual quaternion is normalised, so weights need not sum
+    // to one. Vertices are processed in blocks through the SIMD kernels and large buffers are
+    // split across threads.
+    //
+    // joints, weights and the vertex arrays must be the same size and every joint must index
+    // into bones. Outputs may be the input arrays.
+    ENGINE_M_API void skin(std::span<const DualQuaternion> bones, std::span<const vec4> joints, std::span<const vec4f> weights, const Vec3Array &positions, Vec3Array &outPositions);
+
+    // As above, also rotating normals by the same blended transforms.
+    ENGINE_M_API void skin(std::span<const DualQuaternion> bones, std::span<const vec4> joints, std::span<const vec4f> weights, const Vec3Array &positions, const Vec3Array &normals, Vec3Array &outPositions, Vec3Array &outNormals);
+}
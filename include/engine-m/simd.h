@@ -1,12 +1,46 @@
 #pragma once
 
+#include <cstdint>
+
+#include "engine-m/core.h"
+
 namespace EngineM::SIMD {
     enum class Level {
         Scalar,
         SSE2,
         AVX,
-        AVX2
+        AVX2,
+        AVX2_FMA
+    };
+
+    enum class Feature : uint32_t {
+        SSE2 = 1u << 0,
+        SSE3 = 1u << 1,
+        SSSE3 = 1u << 2,
+        SSE41 = 1u << 3,
+        SSE42 = 1u << 4,
+        POPCNT = 1u << 5,
+        AVX = 1u << 6,
+        FMA = 1u << 7,
+        F16C = 1u << 8,
+        AVX2 = 1u << 9,
+        BMI1 = 1u << 10,
+        BMI2 = 1u << 11,
+        AVX512F = 1u << 12
     };
 
-    Level get_simd_level();
+    // Bitmask of Feature values supported by the processor and OS, queried with cpuid once.
+    ENGINE_M_API uint32_t get_features();
+
+    ENGINE_M_API bool has_feature(Feature);
+
+    // Highest kernel level the processor and OS support.
+    ENGINE_M_API Level get_simd_level();
+
+    // Level used for kernel dispatch. Detected once on first use and cached; the
+    // ENGINEM_SIMD_LEVEL environment variable (scalar, sse2, avx, avx2, avx2_fma) can lower it.
+    ENGINE_M_API Level get_active_level();
+
+    // Forces the dispatch level. Requests above the detected level are clamped to it.
+    ENGINE_M_API Level set_active_level(Level);
 }
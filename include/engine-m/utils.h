@@ -1,13 +1,18 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 
+#include "constants.h"
 #include "core.h"
 #include "vector/vector.h"
 
 namespace EngineM {
 
-    ENGINE_M_API bool equals(float, float);
+    constexpr bool equals(const float a, const float b) {
+        const float d = a - b;
+        return (d < 0 ? -d : d) < epsilon;
+    }
 
     ENGINE_M_API int clamp(int, int, int);
 
@@ -20,8 +25,14 @@ namespace EngineM {
     ENGINE_M_API float lerp(float, float, float);
     ENGINE_M_API vec2f lerp(const vec2f &, const vec2f &, float);
     ENGINE_M_API vec3f lerp(const vec3f &, const vec3f &, float);
+    ENGINE_M_API void lerp(std::span<const vec3f>, std::span<const vec3f>, float, std::span<vec3f>);
+
+    // Evaluates the polynomial with power-basis coefficients c[0] + c[1] t + ... at each t.
+    ENGINE_M_API void evaluatePolynomial(std::span<const vec3f>, std::span<const float>, std::span<vec3f>);
 
     ENGINE_M_API uint64_t factorial(uint64_t);
 
+    // n choose k, read from a precomputed Pascal's triangle up to n = 64 and computed
+    // multiplicatively beyond it, so it does not overflow for any n a float can represent.
     ENGINE_M_API float binomialCoefficient(int, int);
 }
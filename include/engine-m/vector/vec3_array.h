@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "engine-m/core.h"
+#include "engine-m/aligned_buffer.h"
+#include "engine-m/vector/vector.h"
+
+namespace EngineM {
+
+    // Structure-of-arrays storage for vec3f: x, y and z each live in their own 32-byte
+    // aligned stream, padded with zeros to a multiple of 8 lanes.
+    class ENGINE_M_API Vec3Array {
+        size_t count = 0;
+        size_t stride = 0;
+        AlignedBuffer buffer;
+
+    public:
+        static constexpr size_t alignment = AlignedBuffer::alignment;
+        static constexpr size_t lanes = alignment / sizeof(float);
+
+        Vec3Array() = default;
+        explicit Vec3Array(size_t);
+        explicit Vec3Array(std::span<const vec3f>);
+        Vec3Array(const Vec3Array &) = default;
+        Vec3Array(Vec3Array &&) noexcept;
+
+        Vec3Array& operator=(const Vec3Array &);
+        Vec3Array& operator=(Vec3Array &&) noexcept;
+
+        [[nodiscard]] size_t size() const;
+        [[nodiscard]] size_t getStride() const;
+
+        // Stream of component i (0 = x, 1 = y, 2 = z), size() floats long.
+        std::span<float> stream(uint32_t);
+        [[nodiscard]] std::span<const float> stream(uint32_t) const;
+
+        std::span<float> x();
+        std::span<float> y();
+        std::span<float> z();
+        [[nodiscard]] std::span<const float> x() const;
+        [[nodiscard]] std::span<const float> y() const;
+        [[nodiscard]] std::span<const float> z() const;
+
+        [[nodiscard]] vec3f get(size_t) const;
+        void set(size_t, const vec3f &);
+
+        void toPoints(std::span<vec3f>) const;
+
+        Vec3Array operator+(const Vec3Array &) const;
+        Vec3Array& operator+=(const Vec3Array &);
+
+        Vec3Array operator-(const Vec3Array &) const;
+        Vec3Array& operator-=(const Vec3Array &);
+
+        Vec3Array operator*(float) const;
+        Vec3Array& operator*=(float);
+
+        // Per-element results written to a span of size() floats.
+        void dot(const Vec3Array &, std::span<float>) const;
+        void length(std::span<float>) const;
+
+        [[nodiscard]] Vec3Array cross(const Vec3Array &) const;
+
+        // Zero-length elements are left unchanged.
+        Vec3Array& normalise();
+        // Approximate normalise with about 1e-6 relative error; exact at the scalar level.
+        Vec3Array& normaliseFast();
+
+        static Vec3Array lerp(const Vec3Array &, const Vec3Array &, float);
+
+    };
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+#include "engine-m/core.h"
+#include "engine-m/vector/vector.h"
+
+namespace EngineM {
+
+    // 3D float vector padded to four lanes and aligned to 16 bytes, so it loads into a
+    // single SSE register. w is kept at zero by every operation and ignored by dot,
+    // magnitude and comparisons. Converts implicitly to and from vec3f.
+    //
+    // Like Vector, data is the active union member, so constant expressions must go through
+    // data or operator[]; the SSE paths are only taken outside constant evaluation.
+    class ENGINE_M_API Vec3A {
+    public:
+        union {
+            alignas(16) float data[4];
+            struct {
+                float x, y, z, w;
+            };
+        };
+
+        constexpr Vec3A(): data{} {
+
+        }
+
+        constexpr Vec3A(const float x, const float y, const float z): data {x, y, z, 0} {
+
+        }
+
+        constexpr Vec3A(const vec3f &v): data {v.data[0], v.data[1], v.data[2], 0} {
+
+        }
+
+#ifdef ENGINE_M_HAS_SSE
+        explicit Vec3A(const __m128 v) {
+            _mm_store_ps(data, v);
+        }
+
+        [[nodiscard]] __m128 simd() const {
+            return _mm_load_ps(data);
+        }
+#endif
+
+        constexpr Vec3A(const Vec3A &) = default;
+
+        constexpr Vec3A& operator=(const Vec3A &) = default;
+
+        constexpr operator vec3f() const {
+            return {data[0], data[1], data[2]};
+        }
+
+        constexpr float& operator[](const unsigned int i) {
+            assert(i < 3);
+            return data[i];
+        }
+
+        constexpr const float& operator[](const unsigned int i) const {
+            assert(i < 3);
+            return data[i];
+        }
+
+        [[nodiscard]] constexpr Vec3A operator+(const Vec3A &v) const {
+#ifdef ENGINE_M_HAS_SSE
+            if (!std::is_constant_evaluated()) {
+                return Vec3A(_mm_add_ps(simd(), v.simd()));
+            }
+#endif
+            return {data[0] + v.data[0], data[1] + v.data[1], data[2] + v.data[2]};
+        }
+
+        constexpr Vec3A& operator+=(const Vec3A &v) {
+            return *this = *this + v;
+        }
+
+        [[nodiscard]] constexpr Vec3A operator-(const Vec3A &v) const {
+#ifdef ENGINE_M_HAS_SSE
+            if (!std::is_constant_evaluated()) {
+                return Vec3A(_mm_sub_ps(simd(), v.simd()));
+            }
+#endif
+            return {data[0] - v.data[0], data[1] - v.data[1], data[2] - v.data[2]};
+        }
+
+        constexpr Vec3A& operator-=(const Vec3A &v) {
+            return *this = *this - v;
+        }
+
+        [[nodiscard]] constexpr Vec3A operator*(const float k) const {
+#ifdef ENGINE_M_HAS_SSE
+            if (!std::is_constant_evaluated()) {
+                return Vec3A(_mm_mul_ps(simd(), _mm_set1_ps(k)));
+            }
+#endif
+            return {data[0] * k, data[1] * k, data[2] * k};
+        }
+
+        constexpr Vec3A& operator*=(const float k) {
+            return *this = *this * k;
+        }
+
+        [[nodiscard]] constexpr Vec3A operator/(const float k) const {
+#ifdef ENGINE_M_HAS_SSE
+            if (!std::is_constant_evaluated()) {
+                // Divide x, y, z only so w stays zero even when k is zero.
+                return Vec3A(_mm_div_ps(simd(), _mm_setr_ps(k, k, k, 1.0f)));
+            }
+#endif
+            return {data[0] / k, data[1] / k, data[2] / k};
+        }
+
+        constexpr Vec3A& operator/=(const float k) {
+            return *this = *this / k;
+        }
+
+        [[nodiscard]] constexpr Vec3A operator-() const {
+#ifdef ENGINE_M_HAS_SSE
+            if (!std::is_constant_evaluated()) {
+                return Vec3A(_mm_sub_ps(_mm_setzero_ps(), simd()));
+            }
+#endif
+            return {-data[0], -data[1], -data[2]};
+        }
+
+        [[nodiscard]] constexpr float dot(const Vec3A &v) const {
+#ifdef ENGINE_M_HAS_SSE
+            if (!std::is_constant_evaluated()) {
+                const __m128 m = _mm_mul_ps(simd(), v.simd());
+                const __m128 yz = _mm_add_ss(_mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 2, 2, 2)));
+                return _mm_cvtss_f32(_mm_add_ss(m, yz));
+            }
+#endif
+            return data[0] * v.data[0] + data[1] * v.data[1] + data[2] * v.data[2];
+        }
+
+        [[nodiscard]] constexpr float operator*(const Vec3A &v) const {
+            return dot(v);
+        }
+
+        [[nodiscard]] constexpr Vec3A cross(const Vec3A &v) const {
+#ifdef ENGINE_M_HAS_SSE
+            if (!std::is_constant_evaluated()) {
+                // a.yzx * b.zxy - a.zxy * b.yzx; the w lanes cancel to zero.
+                const __m128 a = simd();
+                const __m128 b = v.simd();
+                const __m128 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+                const __m128 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+                const __m128 c = _mm_sub_ps(_mm_mul_ps(a, bYZX), _mm_mul_ps(aYZX, b));
+                return Vec3A(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));
+            }
+#endif
+            return {data[1] * v.data[2] - v.data[1] * data[2], data[2] * v.data[0] - v.data[2] * data[0], data[0] * v.data[1] - v.data[0] * data[1]};
+        }
+
+        [[nodiscard]] constexpr Vec3A operator^(const Vec3A &v) const {
+            return cross(v);
+        }
+
+        constexpr Vec3A& operator^=(const Vec3A &v) {
+            return *this = cross(v);
+        }
+
+        constexpr bool operator==(const Vec3A &v) const {
+            return data[0] == v.data[0] && data[1] == v.data[1] && data[2] == v.data[2];
+        }
+
+        constexpr bool operator!=(const Vec3A &v) const {
+            return !(*this == v);
+        }
+
+        [[nodiscard]] float magnitude() const {
+            return std::sqrt(dot(*this));
+        }
+
+        Vec3A& normalise() {
+            const float squared = dot(*this);
+            if (squared == 0) {
+                return *this;
+            }
+            return *this *= 1.0f / std::sqrt(squared);
+        }
+
+        // See Vector::normaliseFast.
+        Vec3A& normaliseFast() {
+            const float squared = dot(*this);
+            if (squared == 0) {
+                return *this;
+            }
+            return *this *= inverseSqrtFast(squared);
+        }
+
+        ~Vec3A() = default;
+    };
+
+    using vec3fa = Vec3A;
+
+    static_assert(std::is_trivially_copyable_v<vec3fa> && sizeof(vec3fa) == 16 && alignof(vec3fa) == 16);
+}
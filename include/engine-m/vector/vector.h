@@ -2,18 +2,36 @@
 
 #include <cassert>
 #include <cmath>
+#include <type_traits>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define ENGINE_M_HAS_SSE
+#endif
 
 namespace EngineM {
 
+    // 1 / sqrt(x) from the SSE reciprocal square root estimate plus one Newton-Raphson step.
+    inline float inverseSqrtFast(const float x) {
+#ifdef ENGINE_M_HAS_SSE
+        const float r = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+        return r * (1.5f - 0.5f * x * r * r);
+#else
+        return 1.0f / std::sqrt(x);
+#endif
+    }
+
     template <typename T, unsigned int N>
     struct VectorData {
         T data[N];
 
-        VectorData(): data{} {
+        constexpr VectorData(): data{} {
 
         }
     };
 
+    // x, y, z and w alias data through a union. data is the active member, so constant
+    // expressions must go through data or operator[] rather than the named fields.
     template <typename T>
     struct VectorData<T, 2> {
         union {
@@ -23,11 +41,11 @@ namespace EngineM {
             };
         };
 
-        VectorData(): data{} {
+        constexpr VectorData(): data{} {
 
         }
 
-        VectorData(T x, T y): data {x, y} {
+        constexpr VectorData(T x, T y): data {x, y} {
 
         }
     };
@@ -41,11 +59,11 @@ namespace EngineM {
             };
         };
 
-        VectorData(): data{} {
+        constexpr VectorData(): data{} {
 
         }
 
-        VectorData(T x, T y, T z): data {x, y, z} {
+        constexpr VectorData(T x, T y, T z): data {x, y, z} {
 
         }
     };
@@ -59,11 +77,11 @@ namespace EngineM {
             };
         };
 
-        VectorData(): data{} {
+        constexpr VectorData(): data{} {
 
         }
 
-        VectorData(T x, T y, T z, T w): data {x, y, z, w} {
+        constexpr VectorData(T x, T y, T z, T w): data {x, y, z, w} {
 
         }
     };
@@ -71,53 +89,43 @@ namespace EngineM {
     template <typename T, unsigned int N>
     class Vector : public VectorData<T, N> {
     public:
-        Vector(): VectorData<T, N>() {
+        constexpr Vector(): VectorData<T, N>() {
 
         }
 
-        Vector(T x, T y) requires (N == 2): VectorData<T, N>(x, y) {
+        constexpr Vector(T x, T y) requires (N == 2): VectorData<T, N>(x, y) {
 
         }
 
-        Vector(T x, T y, T z) requires (N == 3): VectorData<T, N>(x, y, z) {
+        constexpr Vector(T x, T y, T z) requires (N == 3): VectorData<T, N>(x, y, z) {
 
         }
 
-        Vector(T x, T y, T z, T w) requires (N == 4): VectorData<T, N>(x, y, z, w) {
+        constexpr Vector(T x, T y, T z, T w) requires (N == 4): VectorData<T, N>(x, y, z, w) {
 
         }
 
-        Vector(const Vector<T, N - 1> &v, T a) requires (N > 2) {
+        constexpr Vector(const Vector<T, N - 1> &v, T a) requires (N > 2) {
             for (int i = 0; i < N - 1; i++) {
                 this -> data[i] = v.data[i];
             }
             this -> data[N - 1] = a;
         }
 
-        Vector(const Vector &v) {
-            for (int i = 0; i < N; i++) {
-                this -> data[i] = v.data[i];
-            }
-        }
-
-        Vector& operator=(const Vector &v) {
-            for (int i = 0; i < N; i++) {
-                this -> data[i] = v.data[i];
-            }
+        constexpr Vector(const Vector &) = default;
 
-            return *this;
-        }
+        constexpr Vector& operator=(const Vector &) = default;
 
-        T& operator[](unsigned int i) {
+        constexpr T& operator[](unsigned int i) {
             assert(i < N);
             return this -> data[i];
         }
-        const T& operator[](unsigned int i) const {
+        constexpr const T& operator[](unsigned int i) const {
             assert(i < N);
             return this -> data[i];
         }
 
-        [[nodiscard]] Vector operator+(const Vector &v) const {
+        [[nodiscard]] constexpr Vector operator+(const Vector &v) const {
             Vector out;
             for (int i = 0; i < N; i++) {
                 out.data[i] = this -> data[i] + v.data[i];
@@ -125,14 +133,14 @@ namespace EngineM {
             return out;
         }
 
-        Vector& operator+=(const Vector &v) {
+        constexpr Vector& operator+=(const Vector &v) {
             for (int i = 0; i < N; i++) {
                 this -> data[i] += v.data[i];
             }
             return *this;
         }
 
-        [[nodiscard]] Vector operator-(const Vector &v) const {
+        [[nodiscard]] constexpr Vector operator-(const Vector &v) const {
             Vector out;
             for (int i = 0; i < N; i++) {
                 out.data[i] = this -> data[i] - v.data[i];
@@ -140,14 +148,14 @@ namespace EngineM {
             return out;
         }
 
-        Vector& operator-=(const Vector &v) {
+        constexpr Vector& operator-=(const Vector &v) {
             for (int i = 0; i < N; i++) {
                 this -> data[i] -= v.data[i];
             }
             return *this;
         }
 
-        [[nodiscard]] Vector operator*(T k) const {
+        [[nodiscard]] constexpr Vector operator*(T k) const {
             Vector out;
             for (int i = 0; i < N; i++) {
                 out.data[i] = this -> data[i] * k;
@@ -155,14 +163,14 @@ namespace EngineM {
             return out;
         }
 
-        Vector& operator*=(T k) {
+        constexpr Vector& operator*=(T k) {
             for (int i = 0; i < N; i++) {
                 this -> data[i] *= k;
             }
             return *this;
         }
 
-        [[nodiscard]] Vector operator/(T k) const {
+        [[nodiscard]] constexpr Vector operator/(T k) const {
             Vector out;
             for (int i = 0; i < N; i++) {
                 out.data[i] = this -> data[i] / k;
@@ -170,14 +178,14 @@ namespace EngineM {
             return out;
         }
 
-        Vector& operator/=(T k) {
+        constexpr Vector& operator/=(T k) {
             for (int i = 0; i < N; i++) {
                 this -> data[i] /= k;
             }
             return *this;
         }
 
-        [[nodiscard]] Vector operator-() const {
+        [[nodiscard]] constexpr Vector operator-() const {
             Vector out;
             for (int i = 0; i < N; i++) {
                 out.data[i] = -this -> data[i];
@@ -185,7 +193,7 @@ namespace EngineM {
             return out;
         }
 
-        [[nodiscard]] T dot(const Vector &v) const {
+        [[nodiscard]] constexpr T dot(const Vector &v) const {
             T out = 0;
             for (int i = 0; i < N; i++) {
                 out += this -> data[i] * v.data[i];
@@ -193,37 +201,35 @@ namespace EngineM {
             return out;
         }
 
-        [[nodiscard]] T operator*(const Vector &v) const {
+        [[nodiscard]] constexpr T operator*(const Vector &v) const {
             return dot(v);
         }
 
-        [[nodiscard]] T cross(const Vector &v) const requires (N == 2) {
-            return this -> x * v.y - this -> y * v.x;
+        [[nodiscard]] constexpr T cross(const Vector &v) const requires (N == 2) {
+            return this -> data[0] * v.data[1] - this -> data[1] * v.data[0];
         }
 
-        [[nodiscard]] T operator^(const Vector &v) const requires (N == 2) {
+        [[nodiscard]] constexpr T operator^(const Vector &v) const requires (N == 2) {
             return cross(v);
         }
 
-        [[nodiscard]] Vector cross(const Vector &v) const requires (N == 3) {
-            return {this -> y * v.z - v.y * this -> z, this -> z * v.x - v.z * this -> x, this -> x * v.y - v.x * this -> y};
+        [[nodiscard]] constexpr Vector cross(const Vector &v) const requires (N == 3) {
+            const T (&a)[3] = this -> data;
+            const T (&b)[3] = v.data;
+            return {a[1] * b[2] - b[1] * a[2], a[2] * b[0] - b[2] * a[0], a[0] * b[1] - b[0] * a[1]};
         }
 
-        [[nodiscard]] Vector operator^(const Vector &v) const requires (N == 3) {
+        [[nodiscard]] constexpr Vector operator^(const Vector &v) const requires (N == 3) {
             return cross(v);
         }
 
-        Vector& operator^=(const Vector &v) requires (N == 3) {
-            const float x = this -> y * v.z - v.y * this -> z;
-            const float y = this -> z * v.x - v.z * this -> x;
-            this -> z = this -> x * v.y - v.x * this -> y;
-            this -> x = x;
-            this -> y = y;
+        constexpr Vector& operator^=(const Vector &v) requires (N == 3) {
+            *this = cross(v);
 
             return *this;
         }
 
-        bool operator==(const Vector &v) const {
+        constexpr bool operator==(const Vector &v) const {
             for (int i = 0; i < N; i++) {
                 if (this -> data[i] != v.data[i]) {
                     return false;
@@ -232,46 +238,73 @@ namespace EngineM {
             return true;
         }
 
-        bool operator!=(const Vector &v) const {
+        constexpr bool operator!=(const Vector &v) const {
             return !(*this == v);
         }
 
-        [[nodiscard]] double magnitude() const {
-            double out = 0;
+        // Floating-point vectors are measured in their own precision; integer vectors in double.
+        using magnitude_type = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+        [[nodiscard]] magnitude_type magnitude() const {
+            magnitude_type out = 0;
 
             for (int i = 0; i < N; i++) {
-                out += this -> data[i] * this -> data[i];
+                out += static_cast<magnitude_type>(this -> data[i]) * static_cast<magnitude_type>(this -> data[i]);
             }
 
             return std::sqrt(out);
         }
 
         Vector& normalise() {
-            double mag = magnitude();
-            if (mag == 0) {
+            if constexpr (std::is_floating_point_v<T>) {
+                const T squared = dot(*this);
+                if (squared == 0) {
+                    return *this;
+                }
+                const T k = T(1) / std::sqrt(squared);
+                for (int i = 0; i < N; i++) {
+                    this -> data[i] *= k;
+                }
+            } else {
+                double mag = magnitude();
+                if (mag == 0) {
+                    return *this;
+                }
+                for (int i = 0; i < N; i++) {
+                    this -> data[i] /= mag;
+                }
+            }
+            return *this;
+        }
+
+        // Approximate normalise using a reciprocal square root estimate refined by one
+        // Newton-Raphson step, accurate to about 1e-6 relative error.
+        Vector& normaliseFast() requires std::is_same_v<T, float> {
+            const float squared = dot(*this);
+            if (squared == 0) {
                 return *this;
             }
+            const float k = inverseSqrtFast(squared);
             for (int i = 0; i < N; i++) {
-                this -> data[i] /= mag;
+                this -> data[i] *= k;
             }
             return *this;
         }
 
-        [[nodiscard]] Vector<T, 2> xy() const requires (N == 3 || N == 4) {
-            return { this -> x, this -> y };
+        [[nodiscard]] constexpr Vector<T, 2> xy() const requires (N == 3 || N == 4) {
+            return { this -> data[0], this -> data[1] };
         }
 
-        [[nodiscard]] Vector<T, 2> yz() const requires (N == 3 || N == 4) {
-            return { this -> y, this -> z };
+        [[nodiscard]] constexpr Vector<T, 2> yz() const requires (N == 3 || N == 4) {
+            return { this -> data[1], this -> data[2] };
         }
 
-        [[nodiscard]] Vector<T, 2> xz() const requires (N == 3 || N == 4) {
-            Vector<double, 3> t;
-            return { this -> x, this -> z };
+        [[nodiscard]] constexpr Vector<T, 2> xz() const requires (N == 3 || N == 4) {
+            return { this -> data[0], this -> data[2] };
         }
 
-        [[nodiscard]] Vector<T, 3> xyz() const requires (N == 4) {
-            return { this -> x, this -> y, this -> z };
+        [[nodiscard]] constexpr Vector<T, 3> xyz() const requires (N == 4) {
+            return { this -> data[0], this -> data[1], this -> data[2] };
         }
 
         ~Vector() = default;
@@ -288,4 +321,8 @@ namespace EngineM {
     using vec2d = Vector<double, 2>;
     using vec3d = Vector<double, 3>;
     using vec4d = Vector<double, 4>;
+
+    // Vectors are plain arrays of their components, so containers of them copy with memcpy.
+    static_assert(std::is_trivially_copyable_v<vec3f> && sizeof(vec3f) == 3 * sizeof(float));
+    static_assert(std::is_trivially_copyable_v<vec4d> && sizeof(vec4d) == 4 * sizeof(double));
 }
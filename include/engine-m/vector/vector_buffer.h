@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include "engine-m/core.h"
+#include "engine-m/vector/vector.h"
+
+namespace EngineM {
+
+    // vec3f is three packed floats, so a span of points can be viewed as 3 * size() floats
+    // (e.g. for upload to a GPU vertex buffer) without copying.
+    ENGINE_M_API std::span<const float> asFloats(std::span<const vec3f>);
+    ENGINE_M_API std::span<float> asFloats(std::span<vec3f>);
+
+    // Bulk copies and conversions into caller-owned buffers. Spans must be the same size.
+    ENGINE_M_API void copyPoints(std::span<const vec3f>, std::span<vec3f>);
+    ENGINE_M_API void convertPoints(std::span<const vec3f>, std::span<vec3d>);
+    ENGINE_M_API void convertPoints(std::span<const vec3d>, std::span<vec3f>);
+
+    // Interleaved buffers with stride floats per point (stride >= 3), e.g. stride 4 for
+    // 16-byte aligned float4 layouts. Padding floats are left untouched on pack.
+    ENGINE_M_API void packPoints(std::span<const vec3f>, std::span<float>, size_t stride);
+    ENGINE_M_API void unpackPoints(std::span<const float>, size_t stride, std::span<vec3f>);
+
+    // Normalises each point with the SIMD vector kernels; zero-length points are copied
+    // unchanged and out may alias in. The Fast variant uses the approximate reciprocal
+    // square root (see Vector::normaliseFast).
+    ENGINE_M_API void normalisePoints(std::span<const vec3f>, std::span<vec3f>);
+    ENGINE_M_API void normalisePointsFast(std::span<const vec3f>, std::span<vec3f>);
+}
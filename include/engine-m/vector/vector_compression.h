@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "engine-m/core.h"
+#include "engine-m/vector/vector.h"
+
+namespace EngineM {
+
+    // Compressed vec3f storage. vec3h holds IEEE half bit patterns (6 bytes per point),
+    // vec3sn holds snorm16 components in [-1, 1] (6 bytes) and vec2sn holds an octahedral
+    // snorm16 encoding of a unit vector (4 bytes). The components are encoded bits rather than
+    // values, so these only store and compare them; decode to vec3f for arithmetic.
+    template <typename T, unsigned int N>
+    struct PackedVector {
+        T data[N] {};
+
+        constexpr PackedVector() = default;
+
+        template <typename... C> requires (sizeof...(C) == N)
+        constexpr explicit PackedVector(const C... components): data {static_cast<T>(components)...} {
+
+        }
+
+        constexpr T& operator[](const unsigned int i) {
+            return data[i];
+        }
+
+        constexpr const T& operator[](const unsigned int i) const {
+            return data[i];
+        }
+
+        constexpr bool operator==(const PackedVector &) const = default;
+    };
+
+    using vec3h = PackedVector<uint16_t, 3>;
+    using vec3sn = PackedVector<int16_t, 3>;
+    using vec2sn = PackedVector<int16_t, 2>;
+
+    static_assert(std::is_trivially_copyable_v<vec3h> && sizeof(vec3h) == 3 * sizeof(uint16_t));
+    static_assert(std::is_trivially_copyable_v<vec3sn> && sizeof(vec3sn) == 3 * sizeof(int16_t));
+    static_assert(std::is_trivially_copyable_v<vec2sn> && sizeof(vec2sn) == 2 * sizeof(int16_t));
+
+    // Single float to and from IEEE half, rounding to nearest even.
+    ENGINE_M_API uint16_t floatToHalf(float);
+    ENGINE_M_API float halfToFloat(uint16_t);
+
+    // Bulk conversions using the SIMD vector kernels. Spans must be the same size.
+    ENGINE_M_API void encodeHalf(std::span<const vec3f>, std::span<vec3h>);
+    ENGINE_M_API void decodeHalf(std::span<const vec3h>, std::span<vec3f>);
+
+    // Components outside [-1, 1] are clamped.
+    ENGINE_M_API void encodeSnorm(std::span<const vec3f>, std::span<vec3sn>);
+    ENGINE_M_API void decodeSnorm(std::span<const vec3sn>, std::span<vec3f>);
+
+    // Inputs should be unit length; decoded vectors are normalised. Zero vectors encode as +z.
+    ENGINE_M_API void encodeOctahedral(std::span<const vec3f>, std::span<vec2sn>);
+    ENGINE_M_API void decodeOctahedral(std::span<const vec2sn>, std::span<vec3f>);
+}
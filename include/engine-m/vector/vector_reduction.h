@@ -0,0 +1,34 @@
+#pragma once
+
+#include <span>
+
+#include "engine-m/core.h"
+#include "engine-m/matrix/matrix.h"
+#include "engine-m/vector/vector.h"
+
+namespace EngineM {
+
+    struct ENGINE_M_API AABB {
+        vec3f min;
+        vec3f max;
+    };
+
+    struct ENGINE_M_API DotRange {
+        float min;
+        float max;
+    };
+
+    // Reductions over a set of points using the SIMD vector kernels. Large spans are split
+    // across hardware threads; sums are accumulated in double between blocks, so results
+    // differ from a sequential float loop only by rounding.
+    ENGINE_M_API AABB computeBounds(std::span<const vec3f>);
+    ENGINE_M_API vec3f computeSum(std::span<const vec3f>);
+    ENGINE_M_API vec3f computeCentroid(std::span<const vec3f>);
+
+    // Population covariance (divided by the number of points) about the centroid, e.g. for
+    // PCA-based oriented bounding boxes.
+    ENGINE_M_API mat3f computeCovariance(std::span<const vec3f>);
+
+    // Smallest and largest projection of the points onto a direction.
+    ENGINE_M_API DotRange computeDotRange(std::span<const vec3f>, const vec3f &);
+}
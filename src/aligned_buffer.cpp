@@ -0,0 +1,74 @@
+#include "engine-m/aligned_buffer.h"
+
+#include <algorithm>
+#include <new>
+#include <utility>
+
+namespace EngineM {
+
+    static float* allocate(const size_t n) {
+        if (n == 0) {
+            return nullptr;
+        }
+        auto *data = static_cast<float *>(::operator new(n * sizeof(float), std::align_val_t(AlignedBuffer::alignment)));
+        std::fill_n(data, n, 0.0f);
+        return data;
+    }
+
+    static void deallocate(float *data) {
+        if (data != nullptr) {
+            ::operator delete(data, std::align_val_t(AlignedBuffer::alignment));
+        }
+    }
+
+    AlignedBuffer::AlignedBuffer(const size_t length): buffer(allocate(length)), length(length) {
+
+    }
+
+    AlignedBuffer::AlignedBuffer(const AlignedBuffer &other): buffer(allocate(other.length)), length(other.length) {
+        std::copy_n(other.buffer, length, buffer);
+    }
+
+    AlignedBuffer::AlignedBuffer(AlignedBuffer &&other) noexcept: buffer(std::exchange(other.buffer, nullptr)), length(std::exchange(other.length, 0)) {
+
+    }
+
+    AlignedBuffer& AlignedBuffer::operator=(const AlignedBuffer &other) {
+        if (this == &other) {
+            return *this;
+        }
+        if (length != other.length) {
+            float *replacement = allocate(other.length);
+            deallocate(std::exchange(buffer, replacement));
+            length = other.length;
+        }
+        std::copy_n(other.buffer, length, buffer);
+        return *this;
+    }
+
+    AlignedBuffer& AlignedBuffer::operator=(AlignedBuffer &&other) noexcept {
+        if (this == &other) {
+            return *this;
+        }
+        deallocate(buffer);
+        buffer = std::exchange(other.buffer, nullptr);
+        length = std::exchange(other.length, 0);
+        return *this;
+    }
+
+    float* AlignedBuffer::data() {
+        return buffer;
+    }
+
+    const float* AlignedBuffer::data() const {
+        return buffer;
+    }
+
+    size_t AlignedBuffer::size() const {
+        return length;
+    }
+
+    AlignedBuffer::~AlignedBuffer() {
+        deallocate(buffer);
+    }
+}
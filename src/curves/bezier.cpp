@@ -1,5 +1,6 @@
 #include "engine-m/curves/bezier.h"
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
 
@@ -8,14 +9,38 @@
 
 namespace EngineM {
 
-    BezierCurve::BezierCurve(const int degree): degree(degree), points(degree + 1) {
+    // Evaluates the Bernstein form from binomially weighted control points w_i = C(d, i) p_i.
+    // Factoring out (1 - t)^d (or t^d past the midpoint) leaves a polynomial in a ratio no
+    // larger than one, evaluated with Horner's rule, so no intermediate overflows.
+    static vec3f evaluateBernstein(const vec3f *weighted, const int degree, float t) {
+        t = clamp(t, 0.f, 1.f);
+
+        if (t <= 0.5f) {
+            const float s = t / (1 - t);
+            vec3f result = weighted[degree];
+            for (int i = degree - 1; i >= 0; i--) {
+                result = result * s + weighted[i];
+            }
+            return result * std::pow(1 - t, static_cast<float>(degree));
+        }
+
+        const float s = (1 - t) / t;
+        vec3f result = weighted[0];
+        for (int i = 1; i <= degree; i++) {
+            result = result * s + weighted[i];
+        }
+        return result * std::pow(t, static_cast<float>(degree));
+    }
 
+    BezierCurve::BezierCurve(const int degree): degree(degree), points(degree + 1) {
+        buildCache();
     }
 
     BezierCurve::BezierCurve(const int degree, const std::vector<vec3f> &points): degree(degree), points(points) {
         if (points.size() != degree + 1) {
             throw std::invalid_argument("Number of control points must be equal to degree + 1");
         }
+        buildCache();
     }
 
     vec3f BezierCurve::deCasteljau(const float t) const {
@@ -38,16 +63,16 @@ namespace EngineM {
             }
         }
 
-        auto *first = new BezierCurve(degree);
-        auto *second = new BezierCurve(degree);
+        std::vector<vec3f> first(temp.size());
+        std::vector<vec3f> second(temp.size());
 
         for (int i = 0; i < temp.size(); i++) {
-            (*first)[i] = temp[i][0];
+            first[i] = temp[i][0];
             const size_t j = temp.size() - i - 1;
-            (*second)[i] = temp[j][temp[j].size() - 1];
+            second[i] = temp[j][temp[j].size() - 1];
         }
 
-        return { std::unique_ptr<BezierCurve>(first), std::unique_ptr<BezierCurve>(second) };
+        return { std::make_unique<BezierCurve>(degree, first), std::make_unique<BezierCurve>(degree, second) };
     }
 
     float BezierCurve::legendreGaussQuadratureLength() const {
@@ -67,36 +92,123 @@ namespace EngineM {
         return z * sum;
     }
 
-    vec3f BezierCurve::evaluate(float t) const {
-        t = clamp(t, 0.f, 1.f);
-        if (t == 0) {
-            return points[0];
+    void BezierCurve::buildCache() {
+        // resize keeps the capacity, so only the first build after construction allocates.
+        weighted.resize(std::max(3 * degree, 1));
+        vec3f *curve = weighted.data();
+        vec3f *first = curve + degree + 1;
+        vec3f *second = first + degree;
+
+        for (int i = 0; i < degree; i++) {
+            first[i] = (points[i + 1] - points[i]) * static_cast<float>(degree);
         }
-        if (t == 1) {
-            return points[points.size() - 1];
+        for (int i = 0; i < degree - 1; i++) {
+            second[i] = (first[i + 1] - first[i]) * static_cast<float>(degree - 1);
         }
 
-        vec3f result;
-
-        float pow_t = 1;
-        float pow_1_minus_t = std::pow(1 - t, static_cast<float>(degree));
-        const float k = 1.0f / (1 - t);
+        for (int i = 0; i <= degree; i++) {
+            curve[i] = points[i] * binomialCoefficient(degree, i);
+        }
+        for (int i = 0; i < degree; i++) {
+            first[i] *= binomialCoefficient(degree - 1, i);
+        }
+        for (int i = 0; i < degree - 1; i++) {
+            second[i] *= binomialCoefficient(degree - 2, i);
+        }
 
-        for (int i = 0; i < points.size(); i++) {
-            result += points[i] * binomialCoefficient(degree, i) * pow_t * pow_1_minus_t;
-            pow_t *= t;
-            pow_1_minus_t *= k;
+        if (degree <= powerBasisDegree) {
+            // a_k = C(d, k) Δ^k p_0, with the forward differences taken in place.
+            vec3f differences[powerBasisDegree + 1];
+            std::copy(points.begin(), points.end(), differences);
+            power.resize(3 * degree + 1);
+            for (int k = 0; k <= degree; k++) {
+                power[k] = differences[0] * binomialCoefficient(degree, k);
+                for (int i = 0; i < degree - k; i++) {
+                    differences[i] = differences[i + 1] - differences[i];
+                }
+            }
+            for (int k = 1; k <= degree; k++) {
+                power[degree + k] = power[k] * static_cast<float>(k);
+            }
+            for (int k = 2; k <= degree; k++) {
+                power[2 * degree + k - 1] = power[k] * static_cast<float>(k * (k - 1));
+            }
         }
+    }
 
-        return result;
+    vec3f BezierCurve::evaluate(const float t) const {
+        return evaluateBernstein(weighted.data(), degree, t);
     }
 
     vec3f BezierCurve::tangentAt(const float t) const {
-        return (degree == 1) ? points[1] - points[0] : derivative() -> evaluate(t);
+        if (degree < 1) {
+            return {0, 0, 0};
+        }
+        if (degree == 1) {
+            return points[1] - points[0];
+        }
+        return evaluateBernstein(weighted.data() + degree + 1, degree - 1, t);
     }
 
     vec3f BezierCurve::accelerationAt(const float t) const {
-        return (degree == 1) ? vec3f(0, 0, 0) : derivative() -> tangentAt(t);
+        if (degree <= 1) {
+            return {0, 0, 0};
+        }
+        return evaluateBernstein(weighted.data() + 2 * degree + 1, degree - 2, t);
+    }
+
+    void BezierCurve::evaluateMany(const std::span<const float> t, const std::span<vec3f> out) const {
+        if (degree > powerBasisDegree) {
+            Curve::evaluateMany(t, out);
+            return;
+        }
+        if (t.size() != out.size()) {
+            throw std::invalid_argument("Parameter and output spans must be the same size");
+        }
+        evaluatePowerBasis(std::span<const vec3f>(power).first(degree + 1), t, out);
+    }
+
+    void BezierCurve::tangentMany(const std::span<const float> t, const std::span<vec3f> out) const {
+        if (degree > powerBasisDegree || degree < 1) {
+            Curve::tangentMany(t, out);
+            return;
+        }
+        if (t.size() != out.size()) {
+            throw std::invalid_argument("Parameter and output spans must be the same size");
+        }
+        evaluatePowerBasis(std::span<const vec3f>(power).subspan(degree + 1, degree), t, out);
+    }
+
+    void BezierCurve::accelerationMany(const std::span<const float> t, const std::span<vec3f> out) const {
+        if (degree > powerBasisDegree || degree < 2) {
+            Curve::accelerationMany(t, out);
+            return;
+        }
+        if (t.size() != out.size()) {
+            throw std::invalid_argument("Parameter and output spans must be the same size");
+        }
+        evaluatePowerBasis(std::span<const vec3f>(power).subspan(2 * degree + 1, degree - 1), t, out);
+    }
+
+    void BezierCurve::tessellate(const std::span<vec3f> positions, const std::span<vec3f> tangents) const {
+        if (degree > powerBasisDegree) {
+            Curve::tessellate(positions, tangents);
+            return;
+        }
+        if (!tangents.empty() && tangents.size() != positions.size()) {
+            throw std::invalid_argument("Parameter and output spans must be the same size");
+        }
+        forwardDifference(std::span<const vec3f>(power).first(degree + 1), positions);
+        if (degree < 1) {
+            // A constant curve has no hodograph to difference.
+            std::fill(tangents.begin(), tangents.end(), vec3f(0, 0, 0));
+        } else if (!tangents.empty()) {
+            forwardDifference(std::span<const vec3f>(power).subspan(degree + 1, degree), tangents);
+        }
+    }
+
+    void BezierCurve::flatten(std::vector<vec3f> &out, const float tolerance) const {
+        flattenControlPolygon(points, tolerance, out);
     }
 
     vec3f BezierCurve::normalAt(const float t) const {
@@ -119,17 +231,7 @@ namespace EngineM {
     }
 
     Frame BezierCurve::getFrenetFrame(const float t) const {
-        const vec3f origin = evaluate(t);
-        vec3f tangent = tangentAt(t);
-        tangent.normalise();
-        const vec3f acceleration = accelerationAt(t);
-        const vec3f temp = tangent + acceleration;
-        vec3f rotationAxis = temp ^ tangent;
-        rotationAxis.normalise();
-        vec3f normal = rotationAxis ^ tangent;
-        normal.normalise();
-
-        return { origin, tangent, normal, rotationAxis };
+        return frenetFrame(evaluate(t), tangentAt(t), accelerationAt(t));
     }
 
     Frame BezierCurve::getRMF(float t, const int steps) const {
@@ -152,10 +254,10 @@ namespace EngineM {
             currentFrame.tangent = tangentAt(curr_t);
             currentFrame.tangent.normalise();
 
-            vec3f posDiff = currentFrame.origin - lastFrame.origin;
+            vec3fa posDiff = currentFrame.origin - lastFrame.origin;
             float magSquare = posDiff * posDiff;
-            const vec3f rotationAxisRef = lastFrame.rotationAxis - posDiff * 2 / magSquare * (posDiff * lastFrame.rotationAxis);
-            const vec3f tangentRef = lastFrame.tangent - posDiff * 2 / magSquare * (posDiff * lastFrame.tangent);
+            const vec3fa rotationAxisRef = lastFrame.rotationAxis - posDiff * 2 / magSquare * (posDiff * lastFrame.rotationAxis);
+            const vec3fa tangentRef = lastFrame.tangent - posDiff * 2 / magSquare * (posDiff * lastFrame.tangent);
 
             posDiff = currentFrame.tangent - tangentRef;
             magSquare = posDiff * posDiff;
@@ -174,8 +276,8 @@ namespace EngineM {
         return legendreGaussQuadratureLength();
     }
 
-    vec3f& BezierCurve::operator[](const int i) {
-        return points[i];
+    BezierCurve::PointReference BezierCurve::operator[](const int i) {
+        return {*this, i};
     }
 
     const vec3f& BezierCurve::operator[](const int i) const {
@@ -195,5 +297,14 @@ namespace EngineM {
             throw std::invalid_argument("Number of control points must be equal to degree + 1");
         }
         this -> points = points;
+        buildCache();
+    }
+
+    void BezierCurve::setPoint(const int i, const vec3f &point) {
+        if (i < 0 || i > degree) {
+            throw std::invalid_argument("Control point index out of range");
+        }
+        points[i] = point;
+        buildCache();
     }
 }
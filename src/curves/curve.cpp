@@ -0,0 +1,238 @@
+#include "engine-m/curves/curve.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "engine-m/constants.h"
+#include "engine-m/utils.h"
+
+namespace EngineM {
+
+    // Parameters clamped per call to the polynomial kernel, and samples per framesMany block.
+    static constexpr size_t block = 256;
+
+    // Forward-differenced samples between exact re-anchors; each step accumulates a few ulps per
+    // difference order.
+    static constexpr size_t anchorInterval = 32;
+    static constexpr size_t maxCoefficients = 8;
+
+    static vec3f horner(const std::span<const vec3f> coefficients, const float t) {
+        vec3f result = coefficients.back();
+        for (size_t k = coefficients.size() - 1; k-- > 0;) {
+            result = result * t + coefficients[k];
+        }
+        return result;
+    }
+
+    // Differences of nearby samples cancel almost every significant bit, so anchors are taken
+    // in double.
+    static void horner(const std::span<const vec3f> coefficients, const double t, double (&out)[3]) {
+        for (int c = 0; c < 3; c++) {
+            out[c] = coefficients.back()[c];
+            for (size_t k = coefficients.size() - 1; k-- > 0;) {
+                out[c] = out[c] * t + coefficients[k][c];
+            }
+        }
+    }
+
+    static void checkSize(const size_t t, const size_t out) {
+        if (t != out) {
+            throw std::invalid_argument("Parameter and output spans must be the same size");
+        }
+    }
+
+    Frame Curve::frenetFrame(const vec3f &position, const vec3f &velocity, const vec3f &acceleration) {
+        const vec3fa origin = position;
+        vec3fa tangent = velocity;
+        tangent.normalise();
+        const vec3fa temp = tangent + vec3fa(acceleration);
+        vec3fa rotationAxis = temp ^ tangent;
+        rotationAxis.normalise();
+        vec3fa normal = rotationAxis ^ tangent;
+        normal.normalise();
+
+        return { origin, tangent, normal, rotationAxis };
+    }
+
+    void Curve::evaluatePowerBasis(const std::span<const vec3f> coefficients, const std::span<const float> t, const std::span<vec3f> out) {
+        float clamped[block];
+        for (size_t i = 0; i < t.size(); i += block) {
+            const size_t n = std::min(block, t.size() - i);
+            for (size_t k = 0; k < n; k++) {
+                clamped[k] = clamp(t[i + k], 0.f, 1.f);
+            }
+            evaluatePolynomial(coefficients, std::span<const float>(clamped, n), out.subspan(i, n));
+        }
+    }
+
+    void Curve::forwardDifference(const std::span<const vec3f> coefficients, const std::span<vec3f> out) {
+        if (coefficients.empty() || coefficients.size() > maxCoefficients) {
+            throw std::invalid_argument("Forward differencing needs between 1 and 8 coefficients");
+        }
+        if (out.empty()) {
+            return;
+        }
+        if (out.size() == 1) {
+            out[0] = coefficients[0];
+            return;
+        }
+
+        const size_t degree = coefficients.size() - 1;
+        const double step = 1. / static_cast<double>(out.size() - 1);
+        double anchor[maxCoefficients][3];
+        vec3f differences[maxCoefficients];
+        for (size_t i = 0; i < out.size(); i += anchorInterval) {
+            // Values at the next degree + 1 samples, reduced to their forward differences.
+            for (size_t k = 0; k <= degree; k++) {
+                horner(coefficients, static_cast<double>(i + k) * step, anchor[k]);
+            }
+            for (size_t k = 1; k <= degree; k++) {
+                for (size_t j = degree; j >= k; j--) {
+                    for (int c = 0; c < 3; c++) {
+                        anchor[j][c] -= anchor[j - 1][c];
+                    }
+                }
+            }
+            for (size_t k = 0; k <= degree; k++) {
+                differences[k] = vec3f(static_cast<float>(anchor[k][0]), static_cast<float>(anchor[k][1]), static_cast<float>(anchor[k][2]));
+            }
+
+            const size_t n = std::min(anchorInterval, out.size() - i);
+            for (size_t s = 0; s < n; s++) {
+                out[i + s] = differences[0];
+                for (size_t k = 0; k < degree; k++) {
+                    differences[k] += differences[k + 1];
+                }
+            }
+        }
+        out.back() = horner(coefficients, 1.f);
+    }
+
+    static float segmentDistanceSquared(const vec3f &point, const vec3f &start, const vec3f &end) {
+        const vec3f chord = end - start;
+        const vec3f offset = point - start;
+        const float lengthSquared = chord * chord;
+        if (lengthSquared <= epsilon * epsilon) {
+            return offset * offset;
+        }
+        const vec3f distance = offset - chord * clamp((offset * chord) / lengthSquared, 0.f, 1.f);
+        return distance * distance;
+    }
+
+    void Curve::flattenControlPolygon(const std::span<const vec3f> points, const float tolerance, std::vector<vec3f> &out) {
+        if (!(tolerance > 0)) {
+            throw std::invalid_argument("Flattening tolerance must be positive");
+        }
+        out.clear();
+        if (points.empty()) {
+            return;
+        }
+        out.push_back(points.front());
+
+        // The piece being tested, followed by the right halves waiting to be tested, one per
+        // depth at most.
+        const size_t count = points.size();
+        vec3f local[(maxFlattenDepth + 1) * maxFlattenPoints];
+        std::vector<vec3f> allocated;
+        vec3f *current = local;
+        if (count > maxFlattenPoints) {
+            allocated.resize((maxFlattenDepth + 1) * count);
+            current = allocated.data();
+        }
+        vec3f *pending = current + count;
+        int pendingDepth[maxFlattenDepth];
+        size_t top = 0;
+
+        std::copy(points.begin(), points.end(), current);
+        const float toleranceSquared = tolerance * tolerance;
+        const size_t degree = count - 1;
+        int depth = 0;
+        while (true) {
+            bool flat = true;
+            for (size_t i = 1; i < degree && flat; i++) {
+                flat = segmentDistanceSquared(current[i], current[0], current[degree]) <= toleranceSquared;
+            }
+
+            if (flat || depth == maxFlattenDepth) {
+                out.push_back(current[degree]);
+                if (top == 0) {
+                    break;
+                }
+                top--;
+                std::copy(pending + top * count, pending + (top + 1) * count, current);
+                depth = pendingDepth[top];
+                continue;
+            }
+
+            // De Casteljau at t = 0.5: the right half is computed in its pending slot and the
+            // left half is read off its first point at each level.
+            vec3f *right = pending + top * count;
+            std::copy(current, current + count, right);
+            for (size_t k = 1; k <= degree; k++) {
+                for (size_t i = 0; i + k <= degree; i++) {
+                    right[i] = (right[i] + right[i + 1]) * 0.5f;
+                }
+                current[k] = right[0];
+            }
+            pendingDepth[top++] = ++depth;
+        }
+    }
+
+    void Curve::evaluateMany(const std::span<const float> t, const std::span<vec3f> out) const {
+        checkSize(t.size(), out.size());
+        for (size_t i = 0; i < t.size(); i++) {
+            out[i] = evaluate(t[i]);
+        }
+    }
+
+    void Curve::tangentMany(const std::span<const float> t, const std::span<vec3f> out) const {
+        checkSize(t.size(), out.size());
+        for (size_t i = 0; i < t.size(); i++) {
+            out[i] = tangentAt(t[i]);
+        }
+    }
+
+    void Curve::accelerationMany(const std::span<const float> t, const std::span<vec3f> out) const {
+        checkSize(t.size(), out.size());
+        for (size_t i = 0; i < t.size(); i++) {
+            out[i] = accelerationAt(t[i]);
+        }
+    }
+
+    void Curve::framesMany(const std::span<const float> t, const std::span<Frame> out) const {
+        checkSize(t.size(), out.size());
+
+        vec3f positions[block];
+        vec3f tangents[block];
+        vec3f accelerations[block];
+        for (size_t i = 0; i < t.size(); i += block) {
+            const size_t n = std::min(block, t.size() - i);
+            const std::span<const float> range = t.subspan(i, n);
+            evaluateMany(range, std::span<vec3f>(positions, n));
+            tangentMany(range, std::span<vec3f>(tangents, n));
+            accelerationMany(range, std::span<vec3f>(accelerations, n));
+            for (size_t k = 0; k < n; k++) {
+                out[i + k] = frenetFrame(positions[k], tangents[k], accelerations[k]);
+            }
+        }
+    }
+
+    void Curve::tessellate(const std::span<vec3f> positions, const std::span<vec3f> tangents) const {
+        if (!tangents.empty()) {
+            checkSize(positions.size(), tangents.size());
+        }
+
+        const float step = positions.size() > 1 ? 1.f / static_cast<float>(positions.size() - 1) : 0.f;
+        float t[block];
+        for (size_t i = 0; i < positions.size(); i += block) {
+            const size_t n = std::min(block, positions.size() - i);
+            for (size_t k = 0; k < n; k++) {
+                t[k] = static_cast<float>(i + k) * step;
+            }
+            evaluateMany(std::span<const float>(t, n), positions.subspan(i, n));
+            if (!tangents.empty()) {
+                tangentMany(std::span<const float>(t, n), tangents.subspan(i, n));
+            }
+        }
+    }
+}
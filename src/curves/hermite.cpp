@@ -1,6 +1,7 @@
 #include "engine-m/curves/hermite.h"
 
 #include <iostream>
+#include <stdexcept>
 
 #include "engine-m/constants.h"
 #include "engine-m/utils.h"
@@ -28,6 +29,13 @@ namespace EngineM {
         return z * sum;
     }
 
+    void HermiteCurve::powerBasis(vec3f (&c)[4]) const {
+        c[0] = p1;
+        c[1] = v1;
+        c[2] = (p2 - p1) * 3 - v1 * 2 - v2;
+        c[3] = (p1 - p2) * 2 + v1 + v2;
+    }
+
     vec3f HermiteCurve::evaluate(float t) const {
         t = clamp(t, 0.f, 1.f);
         const float t_square = t * t;
@@ -52,6 +60,53 @@ namespace EngineM {
         return p1 * temp1 + v1 * (temp2 - 2) - p2 * temp1 + v2 * temp2;
     }
 
+    void HermiteCurve::evaluateMany(const std::span<const float> t, const std::span<vec3f> out) const {
+        if (t.size() != out.size()) {
+            throw std::invalid_argument("Parameter and output spans must be the same size");
+        }
+        vec3f c[4];
+        powerBasis(c);
+        evaluatePowerBasis(c, t, out);
+    }
+
+    void HermiteCurve::tangentMany(const std::span<const float> t, const std::span<vec3f> out) const {
+        if (t.size() != out.size()) {
+            throw std::invalid_argument("Parameter and output spans must be the same size");
+        }
+        vec3f c[4];
+        powerBasis(c);
+        const vec3f d[3] = {c[1], c[2] * 2, c[3] * 3};
+        evaluatePowerBasis(d, t, out);
+    }
+
+    void HermiteCurve::accelerationMany(const std::span<const float> t, const std::span<vec3f> out) const {
+        if (t.size() != out.size()) {
+            throw std::invalid_argument("Parameter and output spans must be the same size");
+        }
+        vec3f c[4];
+        powerBasis(c);
+        const vec3f d[2] = {c[2] * 2, c[3] * 6};
+        evaluatePowerBasis(d, t, out);
+    }
+
+    void HermiteCurve::tessellate(const std::span<vec3f> positions, const std::span<vec3f> tangents) const {
+        if (!tangents.empty() && tangents.size() != positions.size()) {
+            throw std::invalid_argument("Parameter and output spans must be the same size");
+        }
+        vec3f c[4];
+        powerBasis(c);
+        forwardDifference(c, positions);
+        if (!tangents.empty()) {
+            const vec3f d[3] = {c[1], c[2] * 2, c[3] * 3};
+            forwardDifference(d, tangents);
+        }
+    }
+
+    void HermiteCurve::flatten(std::vector<vec3f> &out, const float tolerance) const {
+        const vec3f points[4] = {p1, p1 + v1 / 3, p2 - v2 / 3, p2};
+        flattenControlPolygon(points, tolerance, out);
+    }
+
     vec3f HermiteCurve::normalAt(const float t) const {
         const Frame rmf = getRMF(t, 100);
         return rmf.normal;
@@ -68,17 +123,7 @@ namespace EngineM {
     }
 
     Frame HermiteCurve::getFrenetFrame(const float t) const {
-        const vec3f origin = evaluate(t);
-        vec3f tangent = tangentAt(t);
-        tangent.normalise();
-        const vec3f acceleration = accelerationAt(t);
-        const vec3f temp = tangent + acceleration;
-        vec3f rotationAxis = temp ^ tangent;
-        rotationAxis.normalise();
-        vec3f normal = rotationAxis ^ tangent;
-        normal.normalise();
-
-        return { origin, tangent, normal, rotationAxis };
+        return frenetFrame(evaluate(t), tangentAt(t), accelerationAt(t));
     }
 
     Frame HermiteCurve::getRMF(float t, const int steps) const {
@@ -101,10 +146,10 @@ namespace EngineM {
             currentFrame.tangent = tangentAt(curr_t);
             currentFrame.tangent.normalise();
 
-            vec3f posDiff = currentFrame.origin - lastFrame.origin;
+            vec3fa posDiff = currentFrame.origin - lastFrame.origin;
             float magSquare = posDiff * posDiff;
-            const vec3f rotationAxisRef = lastFrame.rotationAxis - posDiff * 2 / magSquare * (posDiff * lastFrame.rotationAxis);
-            const vec3f tangentRef = lastFrame.tangent - posDiff * 2 / magSquare * (posDiff * lastFrame.tangent);
+            const vec3fa rotationAxisRef = lastFrame.rotationAxis - posDiff * 2 / magSquare * (posDiff * lastFrame.rotationAxis);
+            const vec3fa tangentRef = lastFrame.tangent - posDiff * 2 / magSquare * (posDiff * lastFrame.tangent);
 
             posDiff = currentFrame.tangent - tangentRef;
             magSquare = posDiff * posDiff;
@@ -2,7 +2,7 @@
 
 namespace EngineM {
 
-    Frame::Frame(const vec3f &origin, const vec3f &tangent, const vec3f &normal, const vec3f &rotationAxis): origin(origin), tangent(tangent), normal(normal), rotationAxis(rotationAxis) {
+    Frame::Frame(const vec3fa &origin, const vec3fa &tangent, const vec3fa &normal, const vec3fa &rotationAxis): origin(origin), tangent(tangent), normal(normal), rotationAxis(rotationAxis) {
 
     }
 
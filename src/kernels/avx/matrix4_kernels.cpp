@@ -0,0 +1,122 @@
+#include <immintrin.h>
+
+namespace EngineM::kernels::avx {
+    void matrix4_add(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]) {
+        const __m256 first = _mm256_add_ps(_mm256_loadu_ps(a[0]), _mm256_loadu_ps(b[0]));
+        const __m256 second = _mm256_add_ps(_mm256_loadu_ps(a[2]), _mm256_loadu_ps(b[2]));
+
+        _mm256_storeu_ps(out[0], first);
+        _mm256_storeu_ps(out[2], second);
+    }
+
+    void matrix4_sub(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]) {
+        const __m256 first = _mm256_sub_ps(_mm256_loadu_ps(a[0]), _mm256_loadu_ps(b[0]));
+        const __m256 second = _mm256_sub_ps(_mm256_loadu_ps(a[2]), _mm256_loadu_ps(b[2]));
+
+        _mm256_storeu_ps(out[0], first);
+        _mm256_storeu_ps(out[2], second);
+    }
+
+    void matrix4_mul_by_k(const float (&a)[4][4], const float k, float (&out)[4][4]) {
+        const __m256 factor = _mm256_set1_ps(k);
+        const __m256 first = _mm256_mul_ps(_mm256_loadu_ps(a[0]), factor);
+        const __m256 second = _mm256_mul_ps(_mm256_loadu_ps(a[2]), factor);
+
+        _mm256_storeu_ps(out[0], first);
+        _mm256_storeu_ps(out[2], second);
+    }
+
+    // Two output rows per register: each 128-bit lane broadcasts its own row of a.
+    static __m256 mul_rows(const __m256 rows, const __m256 b0, const __m256 b1, const __m256 b2, const __m256 b3) {
+        const __m256 x = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+        const __m256 y = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(1, 1, 1, 1)), b1);
+        const __m256 z = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(2, 2, 2, 2)), b2);
+        const __m256 w = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(3, 3, 3, 3)), b3);
+        return _mm256_add_ps(_mm256_add_ps(x, y), _mm256_add_ps(z, w));
+    }
+
+    void matrix4_mul(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]) {
+        const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b[0]));
+        const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b[1]));
+        const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b[2]));
+        const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b[3]));
+
+        const __m256 first = mul_rows(_mm256_loadu_ps(a[0]), b0, b1, b2, b3);
+        const __m256 second = mul_rows(_mm256_loadu_ps(a[2]), b0, b1, b2, b3);
+
+        _mm256_storeu_ps(out[0], first);
+        _mm256_storeu_ps(out[2], second);
+    }
+
+    void matrix4_transpose(const float (&a)[4][4], float (&out)[4][4]) {
+        __m128 row0 = _mm_loadu_ps(a[0]);
+        __m128 row1 = _mm_loadu_ps(a[1]);
+        __m128 row2 = _mm_loadu_ps(a[2]);
+        __m128 row3 = _mm_loadu_ps(a[3]);
+
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+        _mm_storeu_ps(out[0], row0);
+        _mm_storeu_ps(out[1], row1);
+        _mm_storeu_ps(out[2], row2);
+        _mm_storeu_ps(out[3], row3);
+    }
+
+    void matrix4_mul_vector(const float (&a)[4][4], const float (&v)[4], float (&out)[4]) {
+        const __m128 vec = _mm_loadu_ps(v);
+
+        __m128 p0 = _mm_mul_ps(_mm_loadu_ps(a[0]), vec);
+        __m128 p1 = _mm_mul_ps(_mm_loadu_ps(a[1]), vec);
+        __m128 p2 = _mm_mul_ps(_mm_loadu_ps(a[2]), vec);
+        __m128 p3 = _mm_mul_ps(_mm_loadu_ps(a[3]), vec);
+
+        _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+
+        _mm_storeu_ps(out, _mm_add_ps(_mm_add_ps(p0, p1), _mm_add_ps(p2, p3)));
+    }
+
+    static __m128 cross(const __m128 a, const __m128 b) {
+        const __m128 a_yzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 b_yzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 c = _mm_sub_ps(_mm_mul_ps(a, b_yzx), _mm_mul_ps(a_yzx, b));
+        return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+    }
+
+    bool matrix4_affine_inverse(const float (&a)[4][4], float (&out)[4][4]) {
+        const __m128 row0 = _mm_loadu_ps(a[0]);
+        const __m128 row1 = _mm_loadu_ps(a[1]);
+        const __m128 row2 = _mm_loadu_ps(a[2]);
+
+        // Columns of the inverse rotation, scaled by the determinant. Lane 3 cancels to zero.
+        __m128 c0 = cross(row1, row2);
+        __m128 c1 = cross(row2, row0);
+        __m128 c2 = cross(row0, row1);
+
+        const __m128 p = _mm_mul_ps(row0, c0);
+        __m128 sum = _mm_add_ps(p, _mm_movehl_ps(p, p));
+        sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+        const float det = _mm_cvtss_f32(sum);
+        if (det == 0) {
+            return false;
+        }
+
+        const __m128 invDet = _mm_set1_ps(1.0f / det);
+        c0 = _mm_mul_ps(c0, invDet);
+        c1 = _mm_mul_ps(c1, invDet);
+        c2 = _mm_mul_ps(c2, invDet);
+
+        const __m128 t0 = _mm_shuffle_ps(row0, row0, _MM_SHUFFLE(3, 3, 3, 3));
+        const __m128 t1 = _mm_shuffle_ps(row1, row1, _MM_SHUFFLE(3, 3, 3, 3));
+        const __m128 t2 = _mm_shuffle_ps(row2, row2, _MM_SHUFFLE(3, 3, 3, 3));
+        __m128 translation = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, t0), _mm_mul_ps(c1, t1)), _mm_mul_ps(c2, t2));
+        translation = _mm_sub_ps(_mm_setzero_ps(), translation);
+
+        _MM_TRANSPOSE4_PS(c0, c1, c2, translation);
+
+        _mm_storeu_ps(out[0], c0);
+        _mm_storeu_ps(out[1], c1);
+        _mm_storeu_ps(out[2], c2);
+        _mm_storeu_ps(out[3], _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
+        return true;
+    }
+}
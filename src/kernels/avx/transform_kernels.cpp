@@ -0,0 +1,77 @@
+#include <cstddef>
+#include <immintrin.h>
+
+#include "kernels/xyz_shuffle.h"
+
+namespace EngineM::kernels::avx {
+    struct Transform {
+        __m256 m[3][4];
+
+        explicit Transform(const float (&matrix)[3][4]) {
+            for (int i = 0; i < 3; i++) {
+                for (int j = 0; j < 4; j++) {
+                    m[i][j] = _mm256_set1_ps(matrix[i][j]);
+                }
+            }
+        }
+
+        [[nodiscard]] __m256 row(const int i, const __m256 x, const __m256 y, const __m256 z) const {
+            return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m[i][0], x), _mm256_mul_ps(m[i][1], y)), _mm256_add_ps(_mm256_mul_ps(m[i][2], z), m[i][3]));
+        }
+    };
+
+    static void transform_tail(const float (&m)[3][4], const float *in, float *out, const size_t count) {
+        for (size_t n = 0; n < count; n++, in += 3, out += 3) {
+            const float x = in[0];
+            const float y = in[1];
+            const float z = in[2];
+            out[0] = m[0][0] * x + m[0][1] * y + m[0][2] * z + m[0][3];
+            out[1] = m[1][0] * x + m[1][1] * y + m[1][2] * z + m[1][3];
+            out[2] = m[2][0] * x + m[2][1] * y + m[2][2] * z + m[2][3];
+        }
+    }
+
+    void transform_aos(const float (&m)[3][4], const float *in, float *out, const size_t count) {
+        const Transform transform(m);
+
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8, in += 24, out += 24) {
+            __m256 x, y, z;
+            load_xyz(in, x, y, z);
+
+            const __m256 ox = transform.row(0, x, y, z);
+            const __m256 oy = transform.row(1, x, y, z);
+            const __m256 oz = transform.row(2, x, y, z);
+
+            store_xyz(out, ox, oy, oz);
+        }
+        transform_tail(m, in, out, count - n);
+    }
+
+    void transform_soa(const float (&m)[3][4], const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, const size_t count) {
+        const Transform transform(m);
+
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8) {
+            const __m256 px = _mm256_loadu_ps(x + n);
+            const __m256 py = _mm256_loadu_ps(y + n);
+            const __m256 pz = _mm256_loadu_ps(z + n);
+
+            const __m256 ox = transform.row(0, px, py, pz);
+            const __m256 oy = transform.row(1, px, py, pz);
+            const __m256 oz = transform.row(2, px, py, pz);
+
+            _mm256_storeu_ps(outX + n, ox);
+            _mm256_storeu_ps(outY + n, oy);
+            _mm256_storeu_ps(outZ + n, oz);
+        }
+        for (; n < count; n++) {
+            const float px = x[n];
+            const float py = y[n];
+            const float pz = z[n];
+            outX[n] = m[0][0] * px + m[0][1] * py + m[0][2] * pz + m[0][3];
+            outY[n] = m[1][0] * px + m[1][1] * py + m[1][2] * pz + m[1][3];
+            outZ[n] = m[2][0] * px + m[2][1] * py + m[2][2] * pz + m[2][3];
+        }
+    }
+}
@@ -0,0 +1,116 @@
+#include <cstddef>
+#include <immintrin.h>
+
+#include "kernels/kernel_declarations.h"
+#include "kernels/xyz_shuffle.h"
+
+namespace EngineM::kernels::avx {
+    static __m256 dot(const __m256 ax, const __m256 ay, const __m256 az, const __m256 bx, const __m256 by, const __m256 bz) {
+        return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by)), _mm256_mul_ps(az, bz));
+    }
+
+    void soa_dot(const float *ax, const float *ay, const float *az, const float *bx, const float *by, const float *bz, float *out, const size_t count) {
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8) {
+            _mm256_storeu_ps(out + n, dot(_mm256_loadu_ps(ax + n), _mm256_loadu_ps(ay + n), _mm256_loadu_ps(az + n), _mm256_loadu_ps(bx + n), _mm256_loadu_ps(by + n), _mm256_loadu_ps(bz + n)));
+        }
+        scalar::soa_dot(ax + n, ay + n, az + n, bx + n, by + n, bz + n, out + n, count - n);
+    }
+
+    void soa_cross(const float *ax, const float *ay, const float *az, const float *bx, const float *by, const float *bz, float *outX, float *outY, float *outZ, const size_t count) {
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8) {
+            const __m256 px = _mm256_loadu_ps(ax + n);
+            const __m256 py = _mm256_loadu_ps(ay + n);
+            const __m256 pz = _mm256_loadu_ps(az + n);
+            const __m256 qx = _mm256_loadu_ps(bx + n);
+            const __m256 qy = _mm256_loadu_ps(by + n);
+            const __m256 qz = _mm256_loadu_ps(bz + n);
+
+            const __m256 x = _mm256_sub_ps(_mm256_mul_ps(py, qz), _mm256_mul_ps(pz, qy));
+            const __m256 y = _mm256_sub_ps(_mm256_mul_ps(pz, qx), _mm256_mul_ps(px, qz));
+            const __m256 z = _mm256_sub_ps(_mm256_mul_ps(px, qy), _mm256_mul_ps(py, qx));
+
+            _mm256_storeu_ps(outX + n, x);
+            _mm256_storeu_ps(outY + n, y);
+            _mm256_storeu_ps(outZ + n, z);
+        }
+        scalar::soa_cross(ax + n, ay + n, az + n, bx + n, by + n, bz + n, outX + n, outY + n, outZ + n, count - n);
+    }
+
+    void soa_length(const float *x, const float *y, const float *z, float *out, const size_t count) {
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8) {
+            const __m256 px = _mm256_loadu_ps(x + n);
+            const __m256 py = _mm256_loadu_ps(y + n);
+            const __m256 pz = _mm256_loadu_ps(z + n);
+            _mm256_storeu_ps(out + n, _mm256_sqrt_ps(dot(px, py, pz, px, py, pz)));
+        }
+        scalar::soa_length(x + n, y + n, z + n, out + n, count - n);
+    }
+
+    void soa_normalise(const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, const size_t count) {
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8) {
+            const __m256 px = _mm256_loadu_ps(x + n);
+            const __m256 py = _mm256_loadu_ps(y + n);
+            const __m256 pz = _mm256_loadu_ps(z + n);
+            const __m256 length = _mm256_sqrt_ps(dot(px, py, pz, px, py, pz));
+
+            // Zero-length vectors are left unchanged.
+            const __m256 nonzero = _mm256_cmp_ps(length, _mm256_setzero_ps(), _CMP_GT_OQ);
+            const __m256 divisor = _mm256_blendv_ps(_mm256_set1_ps(1.0f), length, nonzero);
+
+            _mm256_storeu_ps(outX + n, _mm256_div_ps(px, divisor));
+            _mm256_storeu_ps(outY + n, _mm256_div_ps(py, divisor));
+            _mm256_storeu_ps(outZ + n, _mm256_div_ps(pz, divisor));
+        }
+        scalar::soa_normalise(x + n, y + n, z + n, outX + n, outY + n, outZ + n, count - n);
+    }
+
+    void soa_normalise_fast(const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, const size_t count) {
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8) {
+            const __m256 px = _mm256_loadu_ps(x + n);
+            const __m256 py = _mm256_loadu_ps(y + n);
+            const __m256 pz = _mm256_loadu_ps(z + n);
+            const __m256 squared = dot(px, py, pz, px, py, pz);
+
+            // One Newton-Raphson step on the 12-bit estimate: r = r * (1.5 - 0.5 * s * r * r).
+            const __m256 estimate = _mm256_rsqrt_ps(squared);
+            const __m256 refined = _mm256_mul_ps(estimate, _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), squared), _mm256_mul_ps(estimate, estimate))));
+
+            // Zeroing the factor for zero-length vectors leaves them unchanged.
+            const __m256 factor = _mm256_and_ps(refined, _mm256_cmp_ps(squared, _mm256_setzero_ps(), _CMP_GT_OQ));
+
+            _mm256_storeu_ps(outX + n, _mm256_mul_ps(px, factor));
+            _mm256_storeu_ps(outY + n, _mm256_mul_ps(py, factor));
+            _mm256_storeu_ps(outZ + n, _mm256_mul_ps(pz, factor));
+        }
+        scalar::soa_normalise(x + n, y + n, z + n, outX + n, outY + n, outZ + n, count - n);
+    }
+
+    void interleave3(const float *x, const float *y, const float *z, float *xyz, const size_t count) {
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8, xyz += 24) {
+            const __m256 px = _mm256_loadu_ps(x + n);
+            const __m256 py = _mm256_loadu_ps(y + n);
+            const __m256 pz = _mm256_loadu_ps(z + n);
+
+            store_xyz(xyz, px, py, pz);
+        }
+        scalar::interleave3(x + n, y + n, z + n, xyz, count - n);
+    }
+
+    void deinterleave3(const float *xyz, float *x, float *y, float *z, const size_t count) {
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8, xyz += 24) {
+            __m256 px, py, pz;
+            load_xyz(xyz, px, py, pz);
+            _mm256_storeu_ps(x + n, px);
+            _mm256_storeu_ps(y + n, py);
+            _mm256_storeu_ps(z + n, pz);
+        }
+        scalar::deinterleave3(xyz, x + n, y + n, z + n, count - n);
+    }
+}
@@ -0,0 +1,50 @@
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+#include "kernels/kernel_declarations.h"
+
+// Every AVX2 processor also implements F16C, so this tier converts halves in hardware.
+namespace EngineM::kernels::avx2 {
+    static __m256i to_snorm16(const __m256 v) {
+        return _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(v, _mm256_set1_ps(-1.0f)), _mm256_set1_ps(1.0f)), _mm256_set1_ps(32767.0f)));
+    }
+
+    static __m256 from_snorm16(const __m128i v) {
+        return _mm256_max_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(v)), _mm256_set1_ps(1.0f / 32767.0f)), _mm256_set1_ps(-1.0f));
+    }
+
+    void half_encode(const float *in, uint16_t *out, const size_t n) {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+        }
+        scalar::half_encode(in + i, out + i, n - i);
+    }
+
+    void half_decode(const uint16_t *in, float *out, const size_t n) {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            _mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i))));
+        }
+        scalar::half_decode(in + i, out + i, n - i);
+    }
+
+    void snorm16_encode(const float *in, int16_t *out, const size_t n) {
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            // packs works within 128-bit lanes, so restore element order afterwards.
+            const __m256i packed = _mm256_packs_epi32(to_snorm16(_mm256_loadu_ps(in + i)), to_snorm16(_mm256_loadu_ps(in + i + 8)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+        }
+        sse::snorm16_encode(in + i, out + i, n - i);
+    }
+
+    void snorm16_decode(const int16_t *in, float *out, const size_t n) {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            _mm256_storeu_ps(out + i, from_snorm16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i))));
+        }
+        scalar::snorm16_decode(in + i, out + i, n - i);
+    }
+}
@@ -0,0 +1,44 @@
+#include <immintrin.h>
+
+// Rows of a padded mat3f are 16-byte aligned, so each one is a single aligned load or store.
+namespace EngineM::kernels::avx2 {
+    void matrix_padded_add(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]) {
+        _mm_store_ps(out[0], _mm_add_ps(_mm_load_ps(a[0]), _mm_load_ps(b[0])));
+        _mm_store_ps(out[1], _mm_add_ps(_mm_load_ps(a[1]), _mm_load_ps(b[1])));
+        _mm_store_ps(out[2], _mm_add_ps(_mm_load_ps(a[2]), _mm_load_ps(b[2])));
+    }
+
+    void matrix_padded_sub(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]) {
+        _mm_store_ps(out[0], _mm_sub_ps(_mm_load_ps(a[0]), _mm_load_ps(b[0])));
+        _mm_store_ps(out[1], _mm_sub_ps(_mm_load_ps(a[1]), _mm_load_ps(b[1])));
+        _mm_store_ps(out[2], _mm_sub_ps(_mm_load_ps(a[2]), _mm_load_ps(b[2])));
+    }
+
+    void matrix_padded_mul_by_k(const float (&a)[3][4], const float k, float (&out)[3][4]) {
+        const __m128 factor = _mm_set1_ps(k);
+        _mm_store_ps(out[0], _mm_mul_ps(_mm_load_ps(a[0]), factor));
+        _mm_store_ps(out[1], _mm_mul_ps(_mm_load_ps(a[1]), factor));
+        _mm_store_ps(out[2], _mm_mul_ps(_mm_load_ps(a[2]), factor));
+    }
+
+    static __m128 mul_row(const __m128 row, const __m128 b0, const __m128 b1, const __m128 b2) {
+        const __m128 x = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+        const __m128 y = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1)), b1);
+        const __m128 z = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2)), b2);
+        return _mm_add_ps(_mm_add_ps(x, y), z);
+    }
+
+    void matrix_padded_mul(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]) {
+        const __m128 b0 = _mm_load_ps(b[0]);
+        const __m128 b1 = _mm_load_ps(b[1]);
+        const __m128 b2 = _mm_load_ps(b[2]);
+
+        const __m128 r0 = mul_row(_mm_load_ps(a[0]), b0, b1, b2);
+        const __m128 r1 = mul_row(_mm_load_ps(a[1]), b0, b1, b2);
+        const __m128 r2 = mul_row(_mm_load_ps(a[2]), b0, b1, b2);
+
+        _mm_store_ps(out[0], r0);
+        _mm_store_ps(out[1], r1);
+        _mm_store_ps(out[2], r2);
+    }
+}
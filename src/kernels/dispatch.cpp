@@ -0,0 +1,387 @@
+#include "engine-m/kernels.h"
+
+#include "kernels/kernel_declarations.h"
+
+namespace EngineM::kernels {
+
+    static constexpr MatrixKernels scalar_kernels {
+        scalar::matrix_add,
+        scalar::matrix_sub,
+        scalar::matrix_mul_by_k,
+        scalar::matrix_mul,
+        scalar::array_add,
+        scalar::array_sub,
+        scalar::array_mul_by_k,
+        scalar::matrix_mul_aos,
+        scalar::matrix_mul_soa,
+        scalar::matrix_padded_add,
+        scalar::matrix_padded_sub,
+        scalar::matrix_padded_mul_by_k,
+        scalar::matrix_padded_mul,
+        scalar::matrix4_add,
+        scalar::matrix4_sub,
+        scalar::matrix4_mul_by_k,
+        scalar::matrix4_mul,
+        scalar::matrix4_transpose,
+        scalar::matrix4_mul_vector,
+        scalar::matrix4_affine_inverse,
+        scalar::transform_aos,
+        scalar::transform_soa
+    };
+
+    static constexpr MatrixKernels sse_kernels {
+        sse::matrix_add,
+        sse::matrix_sub,
+        sse::matrix_mul_by_k,
+        sse::matrix_mul,
+        sse::array_add,
+        sse::array_sub,
+        sse::array_mul_by_k,
+        sse::matrix_mul_aos,
+        sse::matrix_mul_soa,
+        sse::matrix_padded_add,
+        sse::matrix_padded_sub,
+        sse::matrix_padded_mul_by_k,
+        sse::matrix_padded_mul,
+        sse::matrix4_add,
+        sse::matrix4_sub,
+        sse::matrix4_mul_by_k,
+        sse::matrix4_mul,
+        sse::matrix4_transpose,
+        sse::matrix4_mul_vector,
+        sse::matrix4_affine_inverse,
+        sse::transform_aos,
+        sse::transform_soa
+    };
+
+    static constexpr MatrixKernels avx_kernels {
+        avx::matrix_add,
+        avx::matrix_sub,
+        avx::matrix_mul_by_k,
+        avx::matrix_mul,
+        avx::array_add,
+        avx::array_sub,
+        avx::array_mul_by_k,
+        avx::matrix_mul_aos,
+        avx::matrix_mul_soa,
+        avx::matrix_padded_add,
+        avx::matrix_padded_sub,
+        avx::matrix_padded_mul_by_k,
+        avx::matrix_padded_mul,
+        avx::matrix4_add,
+        avx::matrix4_sub,
+        avx::matrix4_mul_by_k,
+        avx::matrix4_mul,
+        avx::matrix4_transpose,
+        avx::matrix4_mul_vector,
+        avx::matrix4_affine_inverse,
+        avx::transform_aos,
+        avx::transform_soa
+    };
+
+    static constexpr MatrixKernels avx2_kernels {
+        avx2::matrix_add,
+        avx2::matrix_sub,
+        avx2::matrix_mul_by_k,
+        avx2::matrix_mul,
+        avx2::array_add,
+        avx2::array_sub,
+        avx2::array_mul_by_k,
+        avx2::matrix_mul_aos,
+        avx2::matrix_mul_soa,
+        avx2::matrix_padded_add,
+        avx2::matrix_padded_sub,
+        avx2::matrix_padded_mul_by_k,
+        avx2::matrix_padded_mul,
+        avx2::matrix4_add,
+        avx2::matrix4_sub,
+        avx2::matrix4_mul_by_k,
+        avx2::matrix4_mul,
+        avx2::matrix4_transpose,
+        avx2::matrix4_mul_vector,
+        avx2::matrix4_affine_inverse,
+        avx2::transform_aos,
+        avx2::transform_soa
+    };
+
+    static constexpr MatrixKernels fma_kernels {
+        avx2::matrix_add,
+        avx2::matrix_sub,
+        avx2::matrix_mul_by_k,
+        fma::matrix_mul,
+        avx2::array_add,
+        avx2::array_sub,
+        avx2::array_mul_by_k,
+        fma::matrix_mul_aos,
+        fma::matrix_mul_soa,
+        avx2::matrix_padded_add,
+        avx2::matrix_padded_sub,
+        avx2::matrix_padded_mul_by_k,
+        fma::matrix_padded_mul,
+        avx2::matrix4_add,
+        avx2::matrix4_sub,
+        avx2::matrix4_mul_by_k,
+        fma::matrix4_mul,
+        avx2::matrix4_transpose,
+        fma::matrix4_mul_vector,
+        avx2::matrix4_affine_inverse,
+        fma::transform_aos,
+        fma::transform_soa
+    };
+
+    static constexpr CurveKernels scalar_curve_kernels {
+        scalar::lerp,
+        scalar::polynomial
+    };
+
+    static constexpr CurveKernels sse_curve_kernels {
+        sse::lerp,
+        sse::polynomial
+    };
+
+    static constexpr CurveKernels avx_curve_kernels {
+        avx::lerp,
+        avx::polynomial
+    };
+
+    static constexpr CurveKernels avx2_curve_kernels {
+        avx2::lerp,
+        avx2::polynomial
+    };
+
+    static constexpr CurveKernels fma_curve_kernels {
+        fma::lerp,
+        fma::polynomial
+    };
+
+    static constexpr VectorKernels scalar_vector_kernels {
+        scalar::soa_dot,
+        scalar::soa_cross,
+        scalar::soa_length,
+        scalar::soa_normalise,
+        scalar::soa_normalise,
+        scalar::interleave3,
+        scalar::deinterleave3,
+        scalar::half_encode,
+        scalar::half_decode,
+        scalar::snorm16_encode,
+        scalar::snorm16_decode,
+        scalar::octahedral_encode,
+        scalar::octahedral_decode,
+        scalar::reduce_bounds,
+        scalar::reduce_sum,
+        scalar::reduce_covariance,
+        scalar::reduce_dot_range
+    };
+
+    static constexpr VectorKernels sse_vector_kernels {
+        sse::soa_dot,
+        sse::soa_cross,
+        sse::soa_length,
+        sse::soa_normalise,
+        sse::soa_normalise_fast,
+        sse::interleave3,
+        sse::deinterleave3,
+        scalar::half_encode,
+        scalar::half_decode,
+        sse::snorm16_encode,
+        sse::snorm16_decode,
+        sse::octahedral_encode,
+        sse::octahedral_decode,
+        sse::reduce_bounds,
+        sse::reduce_sum,
+        sse::reduce_covariance,
+        sse::reduce_dot_range
+    };
+
+    static constexpr VectorKernels avx_vector_kernels {
+        avx::soa_dot,
+        avx::soa_cross,
+        avx::soa_length,
+        avx::soa_normalise,
+        avx::soa_normalise_fast,
+        avx::interleave3,
+        avx::deinterleave3,
+        scalar::half_encode,
+        scalar::half_decode,
+        sse::snorm16_encode,
+        sse::snorm16_decode,
+        sse::octahedral_encode,
+        sse::octahedral_decode,
+        avx::reduce_bounds,
+        avx::reduce_sum,
+        avx::reduce_covariance,
+        avx::reduce_dot_range
+    };
+
+    static constexpr VectorKernels avx2_vector_kernels {
+        avx2::soa_dot,
+        avx2::soa_cross,
+        avx2::soa_length,
+        avx2::soa_normalise,
+        avx2::soa_normalise_fast,
+        avx2::interleave3,
+        avx2::deinterleave3,
+        avx2::half_encode,
+        avx2::half_decode,
+        avx2::snorm16_encode,
+        avx2::snorm16_decode,
+        sse::octahedral_encode,
+        sse::octahedral_decode,
+        avx2::reduce_bounds,
+        avx2::reduce_sum,
+        avx2::reduce_covariance,
+        avx2::reduce_dot_range
+    };
+
+    static constexpr VectorKernels fma_vector_kernels {
+        fma::soa_dot,
+        fma::soa_cross,
+        fma::soa_length,
+        fma::soa_normalise,
+        fma::soa_normalise_fast,
+        avx2::interleave3,
+        avx2::deinterleave3,
+        avx2::half_encode,
+        avx2::half_decode,
+        avx2::snorm16_encode,
+        avx2::snorm16_decode,
+        sse::octahedral_encode,
+        sse::octahedral_decode,
+        avx2::reduce_bounds,
+        avx2::reduce_sum,
+        fma::reduce_covariance,
+        fma::reduce_dot_range
+    };
+
+    static constexpr QuaternionKernels scalar_quaternion_kernels {
+        scalar::quaternion_rotate,
+        scalar::quaternion_nlerp,
+        scalar::quaternion_slerp_fast,
+        scalar::quaternion_to_matrix3,
+        scalar::quaternion_to_matrix34,
+        scalar::dual_quaternion_blend,
+        scalar::dual_quaternion_transform_points,
+        scalar::dual_quaternion_transform_vectors
+    };
+
+    static constexpr QuaternionKernels sse_quaternion_kernels {
+        sse::quaternion_rotate,
+        sse::quaternion_nlerp,
+        sse::quaternion_slerp_fast,
+        sse::quaternion_to_matrix3,
+        sse::quaternion_to_matrix34,
+        sse::dual_quaternion_blend,
+        sse::dual_quaternion_transform_points,
+        sse::dual_quaternion_transform_vectors
+    };
+
+    static constexpr QuaternionKernels avx_quaternion_kernels {
+        avx::quaternion_rotate,
+        avx::quaternion_nlerp,
+        avx::quaternion_slerp_fast,
+        avx::quaternion_to_matrix3,
+        avx::quaternion_to_matrix34,
+        avx::dual_quaternion_blend,
+        avx::dual_quaternion_transform_points,
+        avx::dual_quaternion_transform_vectors
+    };
+
+    static constexpr QuaternionKernels avx2_quaternion_kernels {
+        avx::quaternion_rotate,
+        avx::quaternion_nlerp,
+        avx::quaternion_slerp_fast,
+        avx::quaternion_to_matrix3,
+        avx::quaternion_to_matrix34,
+        avx::dual_quaternion_blend,
+        avx::dual_quaternion_transform_points,
+        avx::dual_quaternion_transform_vectors
+    };
+
+    static constexpr QuaternionKernels fma_quaternion_kernels {
+        fma::quaternion_rotate,
+        fma::quaternion_nlerp,
+        fma::quaternion_slerp_fast,
+        avx::quaternion_to_matrix3,
+        avx::quaternion_to_matrix34,
+        fma::dual_quaternion_blend,
+        fma::dual_quaternion_transform_points,
+        fma::dual_quaternion_transform_vectors
+    };
+
+    const MatrixKernels& get_matrix_kernels(const SIMD::Level level) {
+        switch (level) {
+            case SIMD::Level::AVX2_FMA:
+                return fma_kernels;
+            case SIMD::Level::AVX2:
+                return avx2_kernels;
+            case SIMD::Level::AVX:
+                return avx_kernels;
+            case SIMD::Level::SSE2:
+                return sse_kernels;
+            default:
+                return scalar_kernels;
+        }
+    }
+
+    const MatrixKernels& get_matrix_kernels() {
+        return get_matrix_kernels(SIMD::get_active_level());
+    }
+
+    const CurveKernels& get_curve_kernels(const SIMD::Level level) {
+        switch (level) {
+            case SIMD::Level::AVX2_FMA:
+                return fma_curve_kernels;
+            case SIMD::Level::AVX2:
+                return avx2_curve_kernels;
+            case SIMD::Level::AVX:
+                return avx_curve_kernels;
+            case SIMD::Level::SSE2:
+                return sse_curve_kernels;
+            default:
+                return scalar_curve_kernels;
+        }
+    }
+
+    const CurveKernels& get_curve_kernels() {
+        return get_curve_kernels(SIMD::get_active_level());
+    }
+
+    const VectorKernels& get_vector_kernels(const SIMD::Level level) {
+        switch (level) {
+            case SIMD::Level::AVX2_FMA:
+                return fma_vector_kernels;
+            case SIMD::Level::AVX2:
+                return avx2_vector_kernels;
+            case SIMD::Level::AVX:
+                return avx_vector_kernels;
+            case SIMD::Level::SSE2:
+                return sse_vector_kernels;
+            default:
+                return scalar_vector_kernels;
+        }
+    }
+
+    const VectorKernels& get_vector_kernels() {
+        return get_vector_kernels(SIMD::get_active_level());
+    }
+
+    const QuaternionKernels& get_quaternion_kernels(const SIMD::Level level) {
+        switch (level) {
+            case SIMD::Level::AVX2_FMA:
+                return fma_quaternion_kernels;
+            case SIMD::Level::AVX2:
+                return avx2_quaternion_kernels;
+            case SIMD::Level::AVX:
+                return avx_quaternion_kernels;
+            case SIMD::Level::SSE2:
+                return sse_quaternion_kernels;
+            default:
+                return scalar_quaternion_kernels;
+        }
+    }
+
+    const QuaternionKernels& get_quaternion_kernels() {
+        return get_quaternion_kernels(SIMD::get_active_level());
+    }
+}
@@ -0,0 +1,40 @@
+#include <immintrin.h>
+
+namespace EngineM::kernels::fma {
+    // Two output rows per register: each 128-bit lane broadcasts its own row of a.
+    static __m256 mul_rows(const __m256 rows, const __m256 b0, const __m256 b1, const __m256 b2, const __m256 b3) {
+        __m256 r = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+        r = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(1, 1, 1, 1)), b1, r);
+        r = _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(2, 2, 2, 2)), b2, r);
+        return _mm256_fmadd_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(3, 3, 3, 3)), b3, r);
+    }
+
+    void matrix4_mul(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]) {
+        const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b[0]));
+        const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b[1]));
+        const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b[2]));
+        const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(b[3]));
+
+        const __m256 first = mul_rows(_mm256_loadu_ps(a[0]), b0, b1, b2, b3);
+        const __m256 second = mul_rows(_mm256_loadu_ps(a[2]), b0, b1, b2, b3);
+
+        _mm256_storeu_ps(out[0], first);
+        _mm256_storeu_ps(out[2], second);
+    }
+
+    void matrix4_mul_vector(const float (&a)[4][4], const float (&v)[4], float (&out)[4]) {
+        __m128 col0 = _mm_loadu_ps(a[0]);
+        __m128 col1 = _mm_loadu_ps(a[1]);
+        __m128 col2 = _mm_loadu_ps(a[2]);
+        __m128 col3 = _mm_loadu_ps(a[3]);
+
+        _MM_TRANSPOSE4_PS(col0, col1, col2, col3);
+
+        __m128 r = _mm_mul_ps(col0, _mm_set1_ps(v[0]));
+        r = _mm_fmadd_ps(col1, _mm_set1_ps(v[1]), r);
+        r = _mm_fmadd_ps(col2, _mm_set1_ps(v[2]), r);
+        r = _mm_fmadd_ps(col3, _mm_set1_ps(v[3]), r);
+
+        _mm_storeu_ps(out, r);
+    }
+}
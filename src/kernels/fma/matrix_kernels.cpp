@@ -0,0 +1,63 @@
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+#include "kernels/scalar_ops.h"
+
+namespace EngineM::kernels::fma {
+    // Loads a row of three floats without reading past it; lane 3 is zero.
+    static __m128 load_row(const float *row) {
+        return _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double *>(row))), _mm_load_ss(row + 2));
+    }
+
+    void matrix_mul_aos(const float *a, const float *b, float *out, const size_t count) {
+        for (size_t n = 0; n < count; n++, a += 9, b += 9, out += 9) {
+            const __m128 b0 = load_row(b);
+            const __m128 b1 = load_row(b + 3);
+            const __m128 b2 = load_row(b + 6);
+
+            const __m128 r0 = _mm_fmadd_ps(_mm_set1_ps(a[2]), b2, _mm_fmadd_ps(_mm_set1_ps(a[1]), b1, _mm_mul_ps(_mm_set1_ps(a[0]), b0)));
+            const __m128 r1 = _mm_fmadd_ps(_mm_set1_ps(a[5]), b2, _mm_fmadd_ps(_mm_set1_ps(a[4]), b1, _mm_mul_ps(_mm_set1_ps(a[3]), b0)));
+            const __m128 r2 = _mm_fmadd_ps(_mm_set1_ps(a[8]), b2, _mm_fmadd_ps(_mm_set1_ps(a[7]), b1, _mm_mul_ps(_mm_set1_ps(a[6]), b0)));
+
+            // Rows are stored in order so each one overwrites the spare lane of the previous.
+            _mm_storeu_ps(out, r0);
+            _mm_storeu_ps(out + 3, r1);
+            _mm_storel_pi(reinterpret_cast<__m64 *>(out + 6), r2);
+            _mm_store_ss(out + 8, _mm_movehl_ps(r2, r2));
+        }
+    }
+
+    void matrix_mul(const float (&a)[3][3], const float (&b)[3][3], float (&out)[3][3]) {
+        matrix_mul_aos(&a[0][0], &b[0][0], &out[0][0], 1);
+    }
+
+    void matrix_mul_soa(const float *a, const float *b, float *out, const size_t stride, const size_t count) {
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8) {
+            __m256 x[9], y[9];
+            for (uint32_t e = 0; e < 9; e++) {
+                x[e] = _mm256_loadu_ps(a + e * stride + n);
+                y[e] = _mm256_loadu_ps(b + e * stride + n);
+            }
+            for (uint32_t i = 0; i < 3; i++) {
+                for (uint32_t j = 0; j < 3; j++) {
+                    const __m256 r = _mm256_fmadd_ps(x[i * 3 + 2], y[6 + j], _mm256_fmadd_ps(x[i * 3 + 1], y[3 + j], _mm256_mul_ps(x[i * 3], y[j])));
+                    _mm256_storeu_ps(out + (i * 3 + j) * stride + n, r);
+                }
+            }
+        }
+        for (; n < count; n++) {
+            float result[9];
+            for (uint32_t i = 0; i < 3; i++) {
+                for (uint32_t j = 0; j < 3; j++) {
+                    result[i * 3 + j] = fmadd_ss(a[(i * 3 + 2) * stride + n], b[(6 + j) * stride + n],
+                        fmadd_ss(a[(i * 3 + 1) * stride + n], b[(3 + j) * stride + n], a[(i * 3) * stride + n] * b[j * stride + n]));
+                }
+            }
+            for (uint32_t e = 0; e < 9; e++) {
+                out[e * stride + n] = result[e];
+            }
+        }
+    }
+}
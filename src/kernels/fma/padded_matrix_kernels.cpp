@@ -0,0 +1,23 @@
+#include <immintrin.h>
+
+namespace EngineM::kernels::fma {
+    static __m128 mul_row(const __m128 row, const __m128 b0, const __m128 b1, const __m128 b2) {
+        __m128 r = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+        r = _mm_fmadd_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1)), b1, r);
+        return _mm_fmadd_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2)), b2, r);
+    }
+
+    void matrix_padded_mul(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]) {
+        const __m128 b0 = _mm_load_ps(b[0]);
+        const __m128 b1 = _mm_load_ps(b[1]);
+        const __m128 b2 = _mm_load_ps(b[2]);
+
+        const __m128 r0 = mul_row(_mm_load_ps(a[0]), b0, b1, b2);
+        const __m128 r1 = mul_row(_mm_load_ps(a[1]), b0, b1, b2);
+        const __m128 r2 = mul_row(_mm_load_ps(a[2]), b0, b1, b2);
+
+        _mm_store_ps(out[0], r0);
+        _mm_store_ps(out[1], r1);
+        _mm_store_ps(out[2], r2);
+    }
+}
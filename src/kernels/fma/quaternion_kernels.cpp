@@ -0,0 +1,136 @@
+#include <cstddef>
+#include <immintrin.h>
+
+#include "kernels/kernel_declarations.h"
+#include "kernels/xyz_shuffle.h"
+
+namespace EngineM::kernels::fma {
+    // Transposes eight (x, y, z, w) quaternions into component registers. Quaternions n and
+    // n + 4 share a register so the in-lane 4x4 transpose leaves the lanes in order.
+    static void load_quaternions(const float *q, __m256 &x, __m256 &y, __m256 &z, __m256 &w) {
+        const __m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(q)), _mm_loadu_ps(q + 16), 1);
+        const __m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(q + 4)), _mm_loadu_ps(q + 20), 1);
+        const __m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(q + 8)), _mm_loadu_ps(q + 24), 1);
+        const __m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(q + 12)), _mm_loadu_ps(q + 28), 1);
+
+        const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        const __m256 t1 = _mm256_unpacklo_ps(r2, r3);
+        const __m256 t2 = _mm256_unpackhi_ps(r0, r1);
+        const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+
+        x = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+        y = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+        z = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        w = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+
+    // Inverse of load_quaternions: the same in-lane transpose, then each half goes back to
+    // its own quaternion.
+    static void store_quaternions(float *q, const __m256 x, const __m256 y, const __m256 z, const __m256 w) {
+        const __m256 t0 = _mm256_unpacklo_ps(x, y);
+        const __m256 t1 = _mm256_unpacklo_ps(z, w);
+        const __m256 t2 = _mm256_unpackhi_ps(x, y);
+        const __m256 t3 = _mm256_unpackhi_ps(z, w);
+
+        const __m256 r0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 r1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m256 r2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 r3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+
+        _mm_storeu_ps(q, _mm256_castps256_ps128(r0));
+        _mm_storeu_ps(q + 4, _mm256_castps256_ps128(r1));
+        _mm_storeu_ps(q + 8, _mm256_castps256_ps128(r2));
+        _mm_storeu_ps(q + 12, _mm256_castps256_ps128(r3));
+        _mm_storeu_ps(q + 16, _mm256_extractf128_ps(r0, 1));
+        _mm_storeu_ps(q + 20, _mm256_extractf128_ps(r1, 1));
+        _mm_storeu_ps(q + 24, _mm256_extractf128_ps(r2, 1));
+        _mm_storeu_ps(q + 28, _mm256_extractf128_ps(r3, 1));
+    }
+
+    void quaternion_rotate(const float *q, const float *in, float *out, const size_t count) {
+        const __m256 two = _mm256_set1_ps(2.0f);
+
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8, q += 32, in += 24, out += 24) {
+            __m256 qx, qy, qz, qw, x, y, z;
+            load_quaternions(q, qx, qy, qz, qw);
+            load_xyz(in, x, y, z);
+
+            const __m256 tx = _mm256_mul_ps(two, _mm256_fmsub_ps(qy, z, _mm256_mul_ps(qz, y)));
+            const __m256 ty = _mm256_mul_ps(two, _mm256_fmsub_ps(qz, x, _mm256_mul_ps(qx, z)));
+            const __m256 tz = _mm256_mul_ps(two, _mm256_fmsub_ps(qx, y, _mm256_mul_ps(qy, x)));
+
+            store_xyz(out,
+                _mm256_add_ps(_mm256_fmadd_ps(qw, tx, x), _mm256_fmsub_ps(qy, tz, _mm256_mul_ps(qz, ty))),
+                _mm256_add_ps(_mm256_fmadd_ps(qw, ty, y), _mm256_fmsub_ps(qz, tx, _mm256_mul_ps(qx, tz))),
+                _mm256_add_ps(_mm256_fmadd_ps(qw, tz, z), _mm256_fmsub_ps(qx, ty, _mm256_mul_ps(qy, tx))));
+        }
+        scalar::quaternion_rotate(q, in, out, count - n);
+    }
+
+    void quaternion_nlerp(const float *a, const float *b, const float *t, float *out, const size_t count) {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 sign = _mm256_set1_ps(-0.0f);
+
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8, a += 32, b += 32, out += 32) {
+            __m256 ax, ay, az, aw, bx, by, bz, bw;
+            load_quaternions(a, ax, ay, az, aw);
+            load_quaternions(b, bx, by, bz, bw);
+
+            const __m256 d = _mm256_fmadd_ps(ax, bx, _mm256_fmadd_ps(ay, by, _mm256_fmadd_ps(az, bz, _mm256_mul_ps(aw, bw))));
+
+            // Flipping the sign of t where the dot product is negative takes the shorter arc.
+            const __m256 tn = _mm256_loadu_ps(t + n);
+            const __m256 s = _mm256_sub_ps(one, tn);
+            const __m256 u = _mm256_xor_ps(tn, _mm256_and_ps(d, sign));
+
+            const __m256 rx = _mm256_fmadd_ps(s, ax, _mm256_mul_ps(u, bx));
+            const __m256 ry = _mm256_fmadd_ps(s, ay, _mm256_mul_ps(u, by));
+            const __m256 rz = _mm256_fmadd_ps(s, az, _mm256_mul_ps(u, bz));
+            const __m256 rw = _mm256_fmadd_ps(s, aw, _mm256_mul_ps(u, bw));
+
+            const __m256 length = _mm256_fmadd_ps(rx, rx, _mm256_fmadd_ps(ry, ry, _mm256_fmadd_ps(rz, rz, _mm256_mul_ps(rw, rw))));
+            const __m256 inv = _mm256_div_ps(one, _mm256_sqrt_ps(length));
+
+            store_quaternions(out, _mm256_mul_ps(rx, inv), _mm256_mul_ps(ry, inv), _mm256_mul_ps(rz, inv), _mm256_mul_ps(rw, inv));
+        }
+        scalar::quaternion_nlerp(a, b, t + n, out, count - n);
+    }
+
+    static __m256 slerp_coefficient(const __m256 t, const __m256 xm1) {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 tt = _mm256_mul_ps(t, t);
+        __m256 acc = one;
+        for (int i = 7; i >= 0; i--) {
+            acc = _mm256_fmadd_ps(_mm256_mul_ps(_mm256_fmsub_ps(_mm256_set1_ps(slerp_u[i]), tt, _mm256_set1_ps(slerp_v[i])), xm1), acc, one);
+        }
+        return _mm256_mul_ps(t, acc);
+    }
+
+    void quaternion_slerp_fast(const float *a, const float *b, const float *t, float *out, const size_t count) {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 sign = _mm256_set1_ps(-0.0f);
+
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8, a += 32, b += 32, out += 32) {
+            __m256 ax, ay, az, aw, bx, by, bz, bw;
+            load_quaternions(a, ax, ay, az, aw);
+            load_quaternions(b, bx, by, bz, bw);
+
+            const __m256 d = _mm256_fmadd_ps(ax, bx, _mm256_fmadd_ps(ay, by, _mm256_fmadd_ps(az, bz, _mm256_mul_ps(aw, bw))));
+            const __m256 xm1 = _mm256_sub_ps(_mm256_andnot_ps(sign, d), one);
+
+            const __m256 tn = _mm256_loadu_ps(t + n);
+            const __m256 s = slerp_coefficient(_mm256_sub_ps(one, tn), xm1);
+            const __m256 u = _mm256_xor_ps(slerp_coefficient(tn, xm1), _mm256_and_ps(d, sign));
+
+            store_quaternions(out,
+                _mm256_fmadd_ps(s, ax, _mm256_mul_ps(u, bx)),
+                _mm256_fmadd_ps(s, ay, _mm256_mul_ps(u, by)),
+                _mm256_fmadd_ps(s, az, _mm256_mul_ps(u, bz)),
+                _mm256_fmadd_ps(s, aw, _mm256_mul_ps(u, bw)));
+        }
+        scalar::quaternion_slerp_fast(a, b, t + n, out, count - n);
+    }
+}
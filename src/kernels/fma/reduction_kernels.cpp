@@ -0,0 +1,72 @@
+#include <cstddef>
+#include <immintrin.h>
+
+#include "kernels/kernel_declarations.h"
+#include "kernels/scalar_ops.h"
+#include "kernels/xyz_shuffle.h"
+
+namespace EngineM::kernels::fma {
+    static float sum(const __m256 v) {
+        alignas(32) float lanes[8];
+        _mm256_store_ps(lanes, v);
+        return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    }
+
+    void reduce_covariance(const float *xyz, const size_t count, const float *centre, float *out) {
+        const __m256 cx = _mm256_set1_ps(centre[0]);
+        const __m256 cy = _mm256_set1_ps(centre[1]);
+        const __m256 cz = _mm256_set1_ps(centre[2]);
+        __m256 acc[6];
+        for (__m256 &a : acc) {
+            a = _mm256_setzero_ps();
+        }
+
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8, xyz += 24) {
+            __m256 x, y, z;
+            load_xyz(xyz, x, y, z);
+            x = _mm256_sub_ps(x, cx);
+            y = _mm256_sub_ps(y, cy);
+            z = _mm256_sub_ps(z, cz);
+
+            acc[0] = _mm256_fmadd_ps(x, x, acc[0]);
+            acc[1] = _mm256_fmadd_ps(x, y, acc[1]);
+            acc[2] = _mm256_fmadd_ps(x, z, acc[2]);
+            acc[3] = _mm256_fmadd_ps(y, y, acc[3]);
+            acc[4] = _mm256_fmadd_ps(y, z, acc[4]);
+            acc[5] = _mm256_fmadd_ps(z, z, acc[5]);
+        }
+        scalar::reduce_covariance(xyz, count - n, centre, out);
+
+        for (int i = 0; i < 6; i++) {
+            out[i] += sum(acc[i]);
+        }
+    }
+
+    void reduce_dot_range(const float *xyz, const size_t count, const float *direction, float *min, float *max) {
+        const __m256 dx = _mm256_set1_ps(direction[0]);
+        const __m256 dy = _mm256_set1_ps(direction[1]);
+        const __m256 dz = _mm256_set1_ps(direction[2]);
+        __m256 lo = _mm256_set1_ps(infinity);
+        __m256 hi = _mm256_set1_ps(-infinity);
+
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8, xyz += 24) {
+            __m256 x, y, z;
+            load_xyz(xyz, x, y, z);
+            const __m256 d = _mm256_fmadd_ps(z, dz, _mm256_fmadd_ps(y, dy, _mm256_mul_ps(x, dx)));
+            lo = _mm256_min_ps(lo, d);
+            hi = _mm256_max_ps(hi, d);
+        }
+        scalar::reduce_dot_range(xyz, count - n, direction, min, max);
+
+        alignas(32) float l[8];
+        alignas(32) float h[8];
+        _mm256_store_ps(l, lo);
+        _mm256_store_ps(h, hi);
+        for (int i = 0; i < 8; i++) {
+            *min = min_ss(*min, l[i]);
+            *max = max_ss(*max, h[i]);
+        }
+    }
+}
@@ -0,0 +1,144 @@
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+#include "kernels/kernel_declarations.h"
+
+namespace EngineM::kernels::fma {
+    // Fetches the dual quaternion of the given influence slot for eight vertices and
+    // transposes the 8x8 block into component registers: c[0..3] real (x, y, z, w),
+    // c[4..7] dual.
+    static void load_bones(const float *bones, const int32_t *joints, const int slot, __m256 (&c)[8]) {
+        __m256 r[8];
+        for (int k = 0; k < 8; k++) {
+            r[k] = _mm256_loadu_ps(bones + 8 * joints[4 * k + slot]);
+        }
+
+        __m256 t[8];
+        for (int k = 0; k < 8; k += 2) {
+            t[k] = _mm256_unpacklo_ps(r[k], r[k + 1]);
+            t[k + 1] = _mm256_unpackhi_ps(r[k], r[k + 1]);
+        }
+
+        __m256 s[8];
+        for (int k = 0; k < 8; k += 4) {
+            s[k] = _mm256_shuffle_ps(t[k], t[k + 2], _MM_SHUFFLE(1, 0, 1, 0));
+            s[k + 1] = _mm256_shuffle_ps(t[k], t[k + 2], _MM_SHUFFLE(3, 2, 3, 2));
+            s[k + 2] = _mm256_shuffle_ps(t[k + 1], t[k + 3], _MM_SHUFFLE(1, 0, 1, 0));
+            s[k + 3] = _mm256_shuffle_ps(t[k + 1], t[k + 3], _MM_SHUFFLE(3, 2, 3, 2));
+        }
+
+        for (int k = 0; k < 4; k++) {
+            c[k] = _mm256_permute2f128_ps(s[k], s[k + 4], 0x20);
+            c[k + 4] = _mm256_permute2f128_ps(s[k], s[k + 4], 0x31);
+        }
+    }
+
+    // Transposes the four weights of eight vertices into one register per influence slot.
+    // Vertices n and n + 4 share a register so the in-lane 4x4 transpose leaves the lanes in order.
+    static void load_weights(const float *weights, __m256 (&w)[4]) {
+        const __m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(weights)), _mm_loadu_ps(weights + 16), 1);
+        const __m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(weights + 4)), _mm_loadu_ps(weights + 20), 1);
+        const __m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(weights + 8)), _mm_loadu_ps(weights + 24), 1);
+        const __m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(weights + 12)), _mm_loadu_ps(weights + 28), 1);
+
+        const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+        const __m256 t1 = _mm256_unpacklo_ps(r2, r3);
+        const __m256 t2 = _mm256_unpackhi_ps(r0, r1);
+        const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+
+        w[0] = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+        w[1] = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+        w[2] = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        w[3] = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+
+    void dual_quaternion_blend(const float *bones, const int32_t *joints, const float *weights, float *out, const size_t stride, const size_t count) {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 sign = _mm256_set1_ps(-0.0f);
+
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8, joints += 32, weights += 32) {
+            __m256 w[4];
+            load_weights(weights, w);
+
+            __m256 first[8];
+            load_bones(bones, joints, 0, first);
+
+            __m256 acc[8];
+            for (int k = 0; k < 8; k++) {
+                acc[k] = _mm256_mul_ps(w[0], first[k]);
+            }
+            for (int s = 1; s < 4; s++) {
+                __m256 c[8];
+                load_bones(bones, joints, s, c);
+
+                // Negate the weight of bones in the opposite hemisphere to the first bone.
+                const __m256 d = _mm256_fmadd_ps(first[0], c[0], _mm256_fmadd_ps(first[1], c[1], _mm256_fmadd_ps(first[2], c[2], _mm256_mul_ps(first[3], c[3]))));
+                const __m256 ws = _mm256_xor_ps(w[s], _mm256_and_ps(d, sign));
+                for (int k = 0; k < 8; k++) {
+                    acc[k] = _mm256_fmadd_ps(ws, c[k], acc[k]);
+                }
+            }
+
+            const __m256 length = _mm256_fmadd_ps(acc[0], acc[0], _mm256_fmadd_ps(acc[1], acc[1], _mm256_fmadd_ps(acc[2], acc[2], _mm256_mul_ps(acc[3], acc[3]))));
+            const __m256 inv = _mm256_div_ps(one, _mm256_sqrt_ps(length));
+            for (int k = 0; k < 8; k++) {
+                _mm256_storeu_ps(out + k * stride + n, _mm256_mul_ps(acc[k], inv));
+            }
+        }
+        scalar::dual_quaternion_blend(bones, joints, weights, out + n, stride, count - n);
+    }
+
+    template <bool translate>
+    static void dual_quaternion_transform(const float *dq, const size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, const size_t count) {
+        const __m256 two = _mm256_set1_ps(2.0f);
+
+        size_t n = 0;
+        for (; n + 8 <= count; n += 8) {
+            const __m256 rx = _mm256_loadu_ps(dq + n);
+            const __m256 ry = _mm256_loadu_ps(dq + stride + n);
+            const __m256 rz = _mm256_loadu_ps(dq + 2 * stride + n);
+            const __m256 rw = _mm256_loadu_ps(dq + 3 * stride + n);
+            const __m256 px = _mm256_loadu_ps(x + n);
+            const __m256 py = _mm256_loadu_ps(y + n);
+            const __m256 pz = _mm256_loadu_ps(z + n);
+
+            const __m256 ux = _mm256_mul_ps(two, _mm256_fmsub_ps(ry, pz, _mm256_mul_ps(rz, py)));
+            const __m256 uy = _mm256_mul_ps(two, _mm256_fmsub_ps(rz, px, _mm256_mul_ps(rx, pz)));
+            const __m256 uz = _mm256_mul_ps(two, _mm256_fmsub_ps(rx, py, _mm256_mul_ps(ry, px)));
+
+            __m256 qx = _mm256_add_ps(_mm256_fmadd_ps(rw, ux, px), _mm256_fmsub_ps(ry, uz, _mm256_mul_ps(rz, uy)));
+            __m256 qy = _mm256_add_ps(_mm256_fmadd_ps(rw, uy, py), _mm256_fmsub_ps(rz, ux, _mm256_mul_ps(rx, uz)));
+            __m256 qz = _mm256_add_ps(_mm256_fmadd_ps(rw, uz, pz), _mm256_fmsub_ps(rx, uy, _mm256_mul_ps(ry, ux)));
+
+            if constexpr (translate) {
+                const __m256 dx = _mm256_loadu_ps(dq + 4 * stride + n);
+                const __m256 dy = _mm256_loadu_ps(dq + 5 * stride + n);
+                const __m256 dz = _mm256_loadu_ps(dq + 6 * stride + n);
+                const __m256 dw = _mm256_loadu_ps(dq + 7 * stride + n);
+
+                qx = _mm256_fmadd_ps(two, _mm256_add_ps(_mm256_fmsub_ps(rw, dx, _mm256_mul_ps(dw, rx)), _mm256_fmsub_ps(ry, dz, _mm256_mul_ps(rz, dy))), qx);
+                qy = _mm256_fmadd_ps(two, _mm256_add_ps(_mm256_fmsub_ps(rw, dy, _mm256_mul_ps(dw, ry)), _mm256_fmsub_ps(rz, dx, _mm256_mul_ps(rx, dz))), qy);
+                qz = _mm256_fmadd_ps(two, _mm256_add_ps(_mm256_fmsub_ps(rw, dz, _mm256_mul_ps(dw, rz)), _mm256_fmsub_ps(rx, dy, _mm256_mul_ps(ry, dx))), qz);
+            }
+
+            _mm256_storeu_ps(outX + n, qx);
+            _mm256_storeu_ps(outY + n, qy);
+            _mm256_storeu_ps(outZ + n, qz);
+        }
+        if constexpr (translate) {
+            scalar::dual_quaternion_transform_points(dq + n, stride, x + n, y + n, z + n, outX + n, outY + n, outZ + n, count - n);
+        } else {
+            scalar::dual_quaternion_transform_vectors(dq + n, stride, x + n, y + n, z + n, outX + n, outY + n, outZ + n, count - n);
+        }
+    }
+
+    void dual_quaternion_transform_points(const float *dq, const size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, const size_t count) {
+        dual_quaternion_transform<true>(dq, stride, x, y, z, outX, outY, outZ, count);
+    }
+
+    void dual_quaternion_transform_vectors(const float *dq, const size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, const size_t count) {
+        dual_quaternion_transform<false>(dq, stride, x, y, z, outX, outY, outZ, count);
+    }
+}
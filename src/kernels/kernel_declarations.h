@@ -1,11 +1,102 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 namespace EngineM::kernels {
+    // Coefficients of the polynomial slerp approximation (Eberly, "A Fast and Accurate
+    // Algorithm for Computing SLERP"). sin(t θ) / sin θ is expanded in powers of cos θ - 1
+    // and truncated after eight terms; the last term is scaled so the truncation error is
+    // spread evenly, keeping the weights within 2e-5 for cos θ in [0, 1].
+    inline constexpr float slerp_mu = 1.85298109240830f;
+    inline constexpr float slerp_u[8] = {1.0f / 3, 1.0f / 10, 1.0f / 21, 1.0f / 36, 1.0f / 55, 1.0f / 78, 1.0f / 105, slerp_mu / 136};
+    inline constexpr float slerp_v[8] = {1.0f / 3, 2.0f / 5, 3.0f / 7, 4.0f / 9, 5.0f / 11, 6.0f / 13, 7.0f / 15, slerp_mu * 8 / 17};
+
+    // Only the kernels that benefit from fused multiply-add; the rest of the tier reuses the
+    // AVX2 tier's entries.
+    namespace fma {
+        void matrix_mul(const float (&a)[3][3], const float (&b)[3][3], float (&out)[3][3]);
+        void matrix_mul_aos(const float *a, const float *b, float *out, size_t count);
+        void matrix_mul_soa(const float *a, const float *b, float *out, size_t stride, size_t count);
+
+        void matrix_padded_mul(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]);
+
+        void matrix4_mul(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]);
+        void matrix4_mul_vector(const float (&a)[4][4], const float (&v)[4], float (&out)[4]);
+
+        void transform_aos(const float (&m)[3][4], const float *in, float *out, size_t count);
+        void transform_soa(const float (&m)[3][4], const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+
+        void lerp(const float *a, const float *b, float t, float *out, size_t n);
+        void polynomial(const float *coefficients, size_t degree, const float *t, float *out, size_t count);
+
+        void soa_dot(const float *ax, const float *ay, const float *az, const float *bx, const float *by, const float *bz, float *out, size_t count);
+        void soa_cross(const float *ax, const float *ay, const float *az, const float *bx, const float *by, const float *bz, float *outX, float *outY, float *outZ, size_t count);
+        void soa_length(const float *x, const float *y, const float *z, float *out, size_t count);
+        void soa_normalise(const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+        void soa_normalise_fast(const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+
+        void reduce_covariance(const float *xyz, size_t count, const float *centre, float *out);
+        void reduce_dot_range(const float *xyz, size_t count, const float *direction, float *min, float *max);
+
+        void quaternion_rotate(const float *q, const float *in, float *out, size_t count);
+        void quaternion_nlerp(const float *a, const float *b, const float *t, float *out, size_t count);
+        void quaternion_slerp_fast(const float *a, const float *b, const float *t, float *out, size_t count);
+
+        void dual_quaternion_blend(const float *bones, const int32_t *joints, const float *weights, float *out, size_t stride, size_t count);
+        void dual_quaternion_transform_points(const float *dq, size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+        void dual_quaternion_transform_vectors(const float *dq, size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+    }
+
+    // The quaternion and skinning kernels gain nothing from AVX2; that tier reuses avx.
     namespace avx2 {
         void matrix_add(const float (&a)[3][3], const float (&b)[3][3], float (&out)[3][3]);
         void matrix_sub(const float (&a)[3][3], const float (&b)[3][3], float (&out)[3][3]);
         void matrix_mul_by_k(const float (&a)[3][3], float k, float (&out)[3][3]);
         void matrix_mul(const float (&a)[3][3], const float (&b)[3][3], float (&out)[3][3]);
+
+        void array_add(const float *a, const float *b, float *out, size_t n);
+        void array_sub(const float *a, const float *b, float *out, size_t n);
+        void array_mul_by_k(const float *a, float k, float *out, size_t n);
+        void matrix_mul_aos(const float *a, const float *b, float *out, size_t count);
+        void matrix_mul_soa(const float *a, const float *b, float *out, size_t stride, size_t count);
+
+        void matrix_padded_add(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]);
+        void matrix_padded_sub(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]);
+        void matrix_padded_mul_by_k(const float (&a)[3][4], float k, float (&out)[3][4]);
+        void matrix_padded_mul(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]);
+
+        void matrix4_add(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]);
+        void matrix4_sub(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]);
+        void matrix4_mul_by_k(const float (&a)[4][4], float k, float (&out)[4][4]);
+        void matrix4_mul(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]);
+        void matrix4_transpose(const float (&a)[4][4], float (&out)[4][4]);
+        void matrix4_mul_vector(const float (&a)[4][4], const float (&v)[4], float (&out)[4]);
+        bool matrix4_affine_inverse(const float (&a)[4][4], float (&out)[4][4]);
+
+        void transform_aos(const float (&m)[3][4], const float *in, float *out, size_t count);
+        void transform_soa(const float (&m)[3][4], const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+
+        void lerp(const float *a, const float *b, float t, float *out, size_t n);
+        void polynomial(const float *coefficients, size_t degree, const float *t, float *out, size_t count);
+
+        void soa_dot(const float *ax, const float *ay, const float *az, const float *bx, const float *by, const float *bz, float *out, size_t count);
+        void soa_cross(const float *ax, const float *ay, const float *az, const float *bx, const float *by, const float *bz, float *outX, float *outY, float *outZ, size_t count);
+        void soa_length(const float *x, const float *y, const float *z, float *out, size_t count);
+        void soa_normalise(const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+        void soa_normalise_fast(const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+        void interleave3(const float *x, const float *y, const float *z, float *xyz, size_t count);
+        void deinterleave3(const float *xyz, float *x, float *y, float *z, size_t count);
+
+        void half_encode(const float *in, uint16_t *out, size_t n);
+        void half_decode(const uint16_t *in, float *out, size_t n);
+        void snorm16_encode(const float *in, int16_t *out, size_t n);
+        void snorm16_decode(const int16_t *in, float *out, size_t n);
+
+        void reduce_bounds(const float *xyz, size_t count, float *min, float *max);
+        void reduce_sum(const float *xyz, size_t count, float *sum);
+        void reduce_covariance(const float *xyz, size_t count, const float *centre, float *out);
+        void reduce_dot_range(const float *xyz, size_t count, const float *direction, float *min, float *max);
     }
 
     namespace avx {
@@ -13,6 +104,54 @@ namespace EngineM::kernels {
         void matrix_sub(const float (&a)[3][3], const float (&b)[3][3], float (&out)[3][3]);
         void matrix_mul_by_k(const float (&a)[3][3], float k, float (&out)[3][3]);
         void matrix_mul(const float (&a)[3][3], const float (&b)[3][3], float (&out)[3][3]);
+
+        void array_add(const float *a, const float *b, float *out, size_t n);
+        void array_sub(const float *a, const float *b, float *out, size_t n);
+        void array_mul_by_k(const float *a, float k, float *out, size_t n);
+        void matrix_mul_aos(const float *a, const float *b, float *out, size_t count);
+        void matrix_mul_soa(const float *a, const float *b, float *out, size_t stride, size_t count);
+
+        void matrix_padded_add(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]);
+        void matrix_padded_sub(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]);
+        void matrix_padded_mul_by_k(const float (&a)[3][4], float k, float (&out)[3][4]);
+        void matrix_padded_mul(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]);
+
+        void matrix4_add(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]);
+        void matrix4_sub(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]);
+        void matrix4_mul_by_k(const float (&a)[4][4], float k, float (&out)[4][4]);
+        void matrix4_mul(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]);
+        void matrix4_transpose(const float (&a)[4][4], float (&out)[4][4]);
+        void matrix4_mul_vector(const float (&a)[4][4], const float (&v)[4], float (&out)[4]);
+        bool matrix4_affine_inverse(const float (&a)[4][4], float (&out)[4][4]);
+
+        void transform_aos(const float (&m)[3][4], const float *in, float *out, size_t count);
+        void transform_soa(const float (&m)[3][4], const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+
+        void lerp(const float *a, const float *b, float t, float *out, size_t n);
+        void polynomial(const float *coefficients, size_t degree, const float *t, float *out, size_t count);
+
+        void soa_dot(const float *ax, const float *ay, const float *az, const float *bx, const float *by, const float *bz, float *out, size_t count);
+        void soa_cross(const float *ax, const float *ay, const float *az, const float *bx, const float *by, const float *bz, float *outX, float *outY, float *outZ, size_t count);
+        void soa_length(const float *x, const float *y, const float *z, float *out, size_t count);
+        void soa_normalise(const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+        void soa_normalise_fast(const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+        void interleave3(const float *x, const float *y, const float *z, float *xyz, size_t count);
+        void deinterleave3(const float *xyz, float *x, float *y, float *z, size_t count);
+
+        void reduce_bounds(const float *xyz, size_t count, float *min, float *max);
+        void reduce_sum(const float *xyz, size_t count, float *sum);
+        void reduce_covariance(const float *xyz, size_t count, const float *centre, float *out);
+        void reduce_dot_range(const float *xyz, size_t count, const float *direction, float *min, float *max);
+
+        void quaternion_rotate(const float *q, const float *in, float *out, size_t count);
+        void quaternion_nlerp(const float *a, const float *b, const float *t, float *out, size_t count);
+        void quaternion_slerp_fast(const float *a, const float *b, const float *t, float *out, size_t count);
+        void quaternion_to_matrix3(const float *q, float *out, size_t count);
+        void quaternion_to_matrix34(const float *q, float *out, size_t count);
+
+        void dual_quaternion_blend(const float *bones, const int32_t *joints, const float *weights, float *out, size_t stride, size_t count);
+        void dual_quaternion_transform_points(const float *dq, size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+        void dual_quaternion_transform_vectors(const float *dq, size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
     }
 
     namespace sse {
@@ -20,6 +159,59 @@ namespace EngineM::kernels {
         void matrix_sub(const float (&a)[3][3], const float (&b)[3][3], float (&out)[3][3]);
         void matrix_mul_by_k(const float (&a)[3][3], float k, float (&out)[3][3]);
         void matrix_mul(const float (&a)[3][3], const float (&b)[3][3], float (&out)[3][3]);
+
+        void array_add(const float *a, const float *b, float *out, size_t n);
+        void array_sub(const float *a, const float *b, float *out, size_t n);
+        void array_mul_by_k(const float *a, float k, float *out, size_t n);
+        void matrix_mul_aos(const float *a, const float *b, float *out, size_t count);
+        void matrix_mul_soa(const float *a, const float *b, float *out, size_t stride, size_t count);
+
+        void matrix_padded_add(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]);
+        void matrix_padded_sub(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]);
+        void matrix_padded_mul_by_k(const float (&a)[3][4], float k, float (&out)[3][4]);
+        void matrix_padded_mul(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]);
+
+        void matrix4_add(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]);
+        void matrix4_sub(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]);
+        void matrix4_mul_by_k(const float (&a)[4][4], float k, float (&out)[4][4]);
+        void matrix4_mul(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]);
+        void matrix4_transpose(const float (&a)[4][4], float (&out)[4][4]);
+        void matrix4_mul_vector(const float (&a)[4][4], const float (&v)[4], float (&out)[4]);
+        bool matrix4_affine_inverse(const float (&a)[4][4], float (&out)[4][4]);
+
+        void transform_aos(const float (&m)[3][4], const float *in, float *out, size_t count);
+        void transform_soa(const float (&m)[3][4], const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+
+        void lerp(const float *a, const float *b, float t, float *out, size_t n);
+        void polynomial(const float *coefficients, size_t degree, const float *t, float *out, size_t count);
+
+        void soa_dot(const float *ax, const float *ay, const float *az, const float *bx, const float *by, const float *bz, float *out, size_t count);
+        void soa_cross(const float *ax, const float *ay, const float *az, const float *bx, const float *by, const float *bz, float *outX, float *outY, float *outZ, size_t count);
+        void soa_length(const float *x, const float *y, const float *z, float *out, size_t count);
+        void soa_normalise(const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+        void soa_normalise_fast(const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+        void interleave3(const float *x, const float *y, const float *z, float *xyz, size_t count);
+        void deinterleave3(const float *xyz, float *x, float *y, float *z, size_t count);
+
+        void snorm16_encode(const float *in, int16_t *out, size_t n);
+        void snorm16_decode(const int16_t *in, float *out, size_t n);
+        void octahedral_encode(const float *xyz, int16_t *out, size_t count);
+        void octahedral_decode(const int16_t *in, float *xyz, size_t count);
+
+        void reduce_bounds(const float *xyz, size_t count, float *min, float *max);
+        void reduce_sum(const float *xyz, size_t count, float *sum);
+        void reduce_covariance(const float *xyz, size_t count, const float *centre, float *out);
+        void reduce_dot_range(const float *xyz, size_t count, const float *direction, float *min, float *max);
+
+        void quaternion_rotate(const float *q, const float *in, float *out, size_t count);
+        void quaternion_nlerp(const float *a, const float *b, const float *t, float *out, size_t count);
+        void quaternion_slerp_fast(const float *a, const float *b, const float *t, float *out, size_t count);
+        void quaternion_to_matrix3(const float *q, float *out, size_t count);
+        void quaternion_to_matrix34(const float *q, float *out, size_t count);
+
+        void dual_quaternion_blend(const float *bones, const int32_t *joints, const float *weights, float *out, size_t stride, size_t count);
+        void dual_quaternion_transform_points(const float *dq, size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+        void dual_quaternion_transform_vectors(const float *dq, size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
     }
 
     namespace scalar {
@@ -27,5 +219,59 @@ namespace EngineM::kernels {
         void matrix_sub(const float (&a)[3][3], const float (&b)[3][3], float (&out)[3][3]);
         void matrix_mul_by_k(const float (&a)[3][3], float k, float (&out)[3][3]);
         void matrix_mul(const float (&a)[3][3], const float (&b)[3][3], float (&out)[3][3]);
+
+        void array_add(const float *a, const float *b, float *out, size_t n);
+        void array_sub(const float *a, const float *b, float *out, size_t n);
+        void array_mul_by_k(const float *a, float k, float *out, size_t n);
+        void matrix_mul_aos(const float *a, const float *b, float *out, size_t count);
+        void matrix_mul_soa(const float *a, const float *b, float *out, size_t stride, size_t count);
+
+        void matrix_padded_add(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]);
+        void matrix_padded_sub(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]);
+        void matrix_padded_mul_by_k(const float (&a)[3][4], float k, float (&out)[3][4]);
+        void matrix_padded_mul(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]);
+
+        void matrix4_add(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]);
+        void matrix4_sub(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]);
+        void matrix4_mul_by_k(const float (&a)[4][4], float k, float (&out)[4][4]);
+        void matrix4_mul(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]);
+        void matrix4_transpose(const float (&a)[4][4], float (&out)[4][4]);
+        void matrix4_mul_vector(const float (&a)[4][4], const float (&v)[4], float (&out)[4]);
+        bool matrix4_affine_inverse(const float (&a)[4][4], float (&out)[4][4]);
+
+        void transform_aos(const float (&m)[3][4], const float *in, float *out, size_t count);
+        void transform_soa(const float (&m)[3][4], const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+
+        void lerp(const float *a, const float *b, float t, float *out, size_t n);
+        void polynomial(const float *coefficients, size_t degree, const float *t, float *out, size_t count);
+
+        void soa_dot(const float *ax, const float *ay, const float *az, const float *bx, const float *by, const float *bz, float *out, size_t count);
+        void soa_cross(const float *ax, const float *ay, const float *az, const float *bx, const float *by, const float *bz, float *outX, float *outY, float *outZ, size_t count);
+        void soa_length(const float *x, const float *y, const float *z, float *out, size_t count);
+        void soa_normalise(const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+        void interleave3(const float *x, const float *y, const float *z, float *xyz, size_t count);
+        void deinterleave3(const float *xyz, float *x, float *y, float *z, size_t count);
+
+        void half_encode(const float *in, uint16_t *out, size_t n);
+        void half_decode(const uint16_t *in, float *out, size_t n);
+        void snorm16_encode(const float *in, int16_t *out, size_t n);
+        void snorm16_decode(const int16_t *in, float *out, size_t n);
+        void octahedral_encode(const float *xyz, int16_t *out, size_t count);
+        void octahedral_decode(const int16_t *in, float *xyz, size_t count);
+
+        void reduce_bounds(const float *xyz, size_t count, float *min, float *max);
+        void reduce_sum(const float *xyz, size_t count, float *sum);
+        void reduce_covariance(const float *xyz, size_t count, const float *centre, float *out);
+        void reduce_dot_range(const float *xyz, size_t count, const float *direction, float *min, float *max);
+
+        void quaternion_rotate(const float *q, const float *in, float *out, size_t count);
+        void quaternion_nlerp(const float *a, const float *b, const float *t, float *out, size_t count);
+        void quaternion_slerp_fast(const float *a, const float *b, const float *t, float *out, size_t count);
+        void quaternion_to_matrix3(const float *q, float *out, size_t count);
+        void quaternion_to_matrix34(const float *q, float *out, size_t count);
+
+        void dual_quaternion_blend(const float *bones, const int32_t *joints, const float *weights, float *out, size_t stride, size_t count);
+        void dual_quaternion_transform_points(const float *dq, size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
+        void dual_quaternion_transform_vectors(const float *dq, size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, size_t count);
     }
 }
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace EngineM::kernels::scalar {
+    static uint32_t bits(const float f) {
+        uint32_t u;
+        std::memcpy(&u, &f, sizeof(u));
+        return u;
+    }
+
+    static float value(const uint32_t u) {
+        float f;
+        std::memcpy(&f, &u, sizeof(f));
+        return f;
+    }
+
+    // Round-to-nearest-even, matching F16C's _MM_FROUND_TO_NEAREST_INT.
+    static uint16_t to_half(const float f) {
+        uint32_t x = bits(f);
+        const uint32_t sign = x & 0x80000000u;
+        x ^= sign;
+
+        uint32_t out;
+        if (x >= (127u + 16u) << 23) {
+            // Overflow to infinity; NaNs stay quiet NaNs.
+            out = x > 0x7f800000u ? 0x7e00u : 0x7c00u;
+        } else if (x < 113u << 23) {
+            // Subnormal or zero: let the FPU round the mantissa by adding a magic constant.
+            constexpr uint32_t magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+            out = bits(value(x) + value(magic)) - magic;
+        } else {
+            const uint32_t odd = (x >> 13) & 1u;
+            x += ((15u - 127u) << 23) + 0xfffu + odd;
+            out = x >> 13;
+        }
+        return static_cast<uint16_t>(out | (sign >> 16));
+    }
+
+    static float from_half(const uint16_t h) {
+        constexpr uint32_t exponent = 0x7c00u << 13;
+        uint32_t out = (h & 0x7fffu) << 13;
+        const uint32_t e = out & exponent;
+        out += (127u - 15u) << 23;
+        if (e == exponent) {
+            out += (128u - 16u) << 23;
+        } else if (e == 0) {
+            out += 1u << 23;
+            out = bits(value(out) - value(113u << 23));
+        }
+        return value(out | ((h & 0x8000u) << 16));
+    }
+
+    static int16_t to_snorm16(const float f) {
+        return static_cast<int16_t>(std::lrint(std::clamp(f, -1.0f, 1.0f) * 32767.0f));
+    }
+
+    static float from_snorm16(const int16_t s) {
+        return std::max(static_cast<float>(s) * (1.0f / 32767.0f), -1.0f);
+    }
+
+    void half_encode(const float *in, uint16_t *out, const size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = to_half(in[i]);
+        }
+    }
+
+    void half_decode(const uint16_t *in, float *out, const size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = from_half(in[i]);
+        }
+    }
+
+    void snorm16_encode(const float *in, int16_t *out, const size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = to_snorm16(in[i]);
+        }
+    }
+
+    void snorm16_decode(const int16_t *in, float *out, const size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = from_snorm16(in[i]);
+        }
+    }
+
+    void octahedral_encode(const float *xyz, int16_t *out, const size_t count) {
+        for (size_t n = 0; n < count; n++, xyz += 3, out += 2) {
+            const float sum = std::abs(xyz[0]) + std::abs(xyz[1]) + std::abs(xyz[2]);
+            const float k = sum > 0 ? 1.0f / sum : 0.0f;
+            float u = xyz[0] * k;
+            float v = xyz[1] * k;
+            if (xyz[2] < 0) {
+                // Fold the lower hemisphere over the diagonals.
+                const float foldedU = (1.0f - std::abs(v)) * (u >= 0 ? 1.0f : -1.0f);
+                const float foldedV = (1.0f - std::abs(u)) * (v >= 0 ? 1.0f : -1.0f);
+                u = foldedU;
+                v = foldedV;
+            }
+            out[0] = to_snorm16(u);
+            out[1] = to_snorm16(v);
+        }
+    }
+
+    void octahedral_decode(const int16_t *in, float *xyz, const size_t count) {
+        for (size_t n = 0; n < count; n++, in += 2, xyz += 3) {
+            float u = from_snorm16(in[0]);
+            float v = from_snorm16(in[1]);
+            const float z = 1.0f - std::abs(u) - std::abs(v);
+            const float t = std::max(-z, 0.0f);
+            u += u >= 0 ? -t : t;
+            v += v >= 0 ? -t : t;
+            const float length = std::sqrt(u * u + v * v + z * z);
+            xyz[0] = u / length;
+            xyz[1] = v / length;
+            xyz[2] = z / length;
+        }
+    }
+}
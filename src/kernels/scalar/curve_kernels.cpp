@@ -0,0 +1,28 @@
+#include <cstddef>
+
+namespace EngineM::kernels::scalar {
+    void lerp(const float *a, const float *b, const float t, float *out, const size_t n) {
+        const float one_minus_t = 1 - t;
+        for (size_t i = 0; i < n; i++) {
+            out[i] = a[i] * one_minus_t + b[i] * t;
+        }
+    }
+
+    void polynomial(const float *coefficients, const size_t degree, const float *t, float *out, const size_t count) {
+        for (size_t n = 0; n < count; n++, out += 3) {
+            const float *c = coefficients + 3 * degree;
+            float x = c[0];
+            float y = c[1];
+            float z = c[2];
+            for (size_t k = degree; k-- > 0;) {
+                c -= 3;
+                x = x * t[n] + c[0];
+                y = y * t[n] + c[1];
+                z = z * t[n] + c[2];
+            }
+            out[0] = x;
+            out[1] = y;
+            out[2] = z;
+        }
+    }
+}
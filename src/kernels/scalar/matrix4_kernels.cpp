@@ -0,0 +1,83 @@
+#include <cstdint>
+
+namespace EngineM::kernels::scalar {
+    void matrix4_add(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]) {
+        for (uint32_t i = 0; i < 4; i++) {
+            for (uint32_t j = 0; j < 4; j++) {
+                out[i][j] = a[i][j] + b[i][j];
+            }
+        }
+    }
+
+    void matrix4_sub(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]) {
+        for (uint32_t i = 0; i < 4; i++) {
+            for (uint32_t j = 0; j < 4; j++) {
+                out[i][j] = a[i][j] - b[i][j];
+            }
+        }
+    }
+
+    void matrix4_mul_by_k(const float (&a)[4][4], const float k, float (&out)[4][4]) {
+        for (uint32_t i = 0; i < 4; i++) {
+            for (uint32_t j = 0; j < 4; j++) {
+                out[i][j] = a[i][j] * k;
+            }
+        }
+    }
+
+    void matrix4_mul(const float (&a)[4][4], const float (&b)[4][4], float (&out)[4][4]) {
+        for (uint32_t i = 0; i < 4; i++) {
+            for (uint32_t j = 0; j < 4; j++) {
+                out[i][j] = 0.0f;
+                for (uint32_t k = 0; k < 4; k++) {
+                    out[i][j] += a[i][k] * b[k][j];
+                }
+            }
+        }
+    }
+
+    void matrix4_transpose(const float (&a)[4][4], float (&out)[4][4]) {
+        for (uint32_t i = 0; i < 4; i++) {
+            for (uint32_t j = 0; j < 4; j++) {
+                out[j][i] = a[i][j];
+            }
+        }
+    }
+
+    void matrix4_mul_vector(const float (&a)[4][4], const float (&v)[4], float (&out)[4]) {
+        for (uint32_t i = 0; i < 4; i++) {
+            out[i] = a[i][0] * v[0] + a[i][1] * v[1] + a[i][2] * v[2] + a[i][3] * v[3];
+        }
+    }
+
+    bool matrix4_affine_inverse(const float (&a)[4][4], float (&out)[4][4]) {
+        const float c00 = a[1][1] * a[2][2] - a[1][2] * a[2][1];
+        const float c01 = a[1][2] * a[2][0] - a[1][0] * a[2][2];
+        const float c02 = a[1][0] * a[2][1] - a[1][1] * a[2][0];
+
+        const float det = a[0][0] * c00 + a[0][1] * c01 + a[0][2] * c02;
+        if (det == 0) {
+            return false;
+        }
+        const float invDet = 1.0f / det;
+
+        const float r[3][3] = {
+            { c00 * invDet, (a[0][2] * a[2][1] - a[0][1] * a[2][2]) * invDet, (a[0][1] * a[1][2] - a[0][2] * a[1][1]) * invDet },
+            { c01 * invDet, (a[0][0] * a[2][2] - a[0][2] * a[2][0]) * invDet, (a[0][2] * a[1][0] - a[0][0] * a[1][2]) * invDet },
+            { c02 * invDet, (a[0][1] * a[2][0] - a[0][0] * a[2][1]) * invDet, (a[0][0] * a[1][1] - a[0][1] * a[1][0]) * invDet }
+        };
+        const float t[3] = { a[0][3], a[1][3], a[2][3] };
+
+        for (uint32_t i = 0; i < 3; i++) {
+            out[i][0] = r[i][0];
+            out[i][1] = r[i][1];
+            out[i][2] = r[i][2];
+            out[i][3] = -(r[i][0] * t[0] + r[i][1] * t[1] + r[i][2] * t[2]);
+        }
+        out[3][0] = 0.0f;
+        out[3][1] = 0.0f;
+        out[3][2] = 0.0f;
+        out[3][3] = 1.0f;
+        return true;
+    }
+}
@@ -1,3 +1,4 @@
+#include <cstddef>
 #include <cstdint>
 
 namespace EngineM::kernels::scalar {
@@ -47,4 +48,52 @@ namespace EngineM::kernels::scalar {
             }
         }
     }
-}
\ No newline at end of file
+
+    void array_add(const float *a, const float *b, float *out, const size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = a[i] + b[i];
+        }
+    }
+
+    void array_sub(const float *a, const float *b, float *out, const size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = a[i] - b[i];
+        }
+    }
+
+    void array_mul_by_k(const float *a, const float k, float *out, const size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = a[i] * k;
+        }
+    }
+
+    void matrix_mul_aos(const float *a, const float *b, float *out, const size_t count) {
+        for (size_t n = 0; n < count; n++, a += 9, b += 9, out += 9) {
+            float result[9];
+            for (uint32_t i = 0; i < 3; i++) {
+                for (uint32_t j = 0; j < 3; j++) {
+                    result[i * 3 + j] = a[i * 3] * b[j] + a[i * 3 + 1] * b[3 + j] + a[i * 3 + 2] * b[6 + j];
+                }
+            }
+            for (uint32_t e = 0; e < 9; e++) {
+                out[e] = result[e];
+            }
+        }
+    }
+
+    void matrix_mul_soa(const float *a, const float *b, float *out, const size_t stride, const size_t count) {
+        for (size_t n = 0; n < count; n++) {
+            float result[9];
+            for (uint32_t i = 0; i < 3; i++) {
+                for (uint32_t j = 0; j < 3; j++) {
+                    result[i * 3 + j] = a[(i * 3) * stride + n] * b[j * stride + n]
+                        + a[(i * 3 + 1) * stride + n] * b[(3 + j) * stride + n]
+                        + a[(i * 3 + 2) * stride + n] * b[(6 + j) * stride + n];
+                }
+            }
+            for (uint32_t e = 0; e < 9; e++) {
+                out[e * stride + n] = result[e];
+            }
+        }
+    }
+}
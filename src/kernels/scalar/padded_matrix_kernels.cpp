@@ -0,0 +1,41 @@
+#include <cstdint>
+
+namespace EngineM::kernels::scalar {
+    void matrix_padded_add(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]) {
+        for (uint32_t i = 0; i < 3; i++) {
+            for (uint32_t j = 0; j < 4; j++) {
+                out[i][j] = a[i][j] + b[i][j];
+            }
+        }
+    }
+
+    void matrix_padded_sub(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]) {
+        for (uint32_t i = 0; i < 3; i++) {
+            for (uint32_t j = 0; j < 4; j++) {
+                out[i][j] = a[i][j] - b[i][j];
+            }
+        }
+    }
+
+    void matrix_padded_mul_by_k(const float (&a)[3][4], const float k, float (&out)[3][4]) {
+        for (uint32_t i = 0; i < 3; i++) {
+            for (uint32_t j = 0; j < 4; j++) {
+                out[i][j] = a[i][j] * k;
+            }
+        }
+    }
+
+    void matrix_padded_mul(const float (&a)[3][4], const float (&b)[3][4], float (&out)[3][4]) {
+        float result[3][4];
+        for (uint32_t i = 0; i < 3; i++) {
+            for (uint32_t j = 0; j < 4; j++) {
+                result[i][j] = a[i][0] * b[0][j] + a[i][1] * b[1][j] + a[i][2] * b[2][j];
+            }
+        }
+        for (uint32_t i = 0; i < 3; i++) {
+            for (uint32_t j = 0; j < 4; j++) {
+                out[i][j] = result[i][j];
+            }
+        }
+    }
+}
@@ -0,0 +1,115 @@
+#include <cmath>
+#include <cstddef>
+
+#include "kernels/kernel_declarations.h"
+
+namespace EngineM::kernels::scalar {
+    void quaternion_rotate(const float *q, const float *in, float *out, const size_t count) {
+        for (size_t n = 0; n < count; n++, q += 4, in += 3, out += 3) {
+            const float x = in[0];
+            const float y = in[1];
+            const float z = in[2];
+
+            // v' = v + w t + q.v x t with t = 2 (q.v x v).
+            const float tx = 2 * (q[1] * z - q[2] * y);
+            const float ty = 2 * (q[2] * x - q[0] * z);
+            const float tz = 2 * (q[0] * y - q[1] * x);
+
+            out[0] = x + q[3] * tx + (q[1] * tz - q[2] * ty);
+            out[1] = y + q[3] * ty + (q[2] * tx - q[0] * tz);
+            out[2] = z + q[3] * tz + (q[0] * ty - q[1] * tx);
+        }
+    }
+
+    void quaternion_nlerp(const float *a, const float *b, const float *t, float *out, const size_t count) {
+        for (size_t n = 0; n < count; n++, a += 4, b += 4, out += 4) {
+            const float d = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+
+            // Negating b when the quaternions are more than 90 degrees apart takes the shorter arc.
+            const float s = 1 - t[n];
+            const float u = d < 0 ? -t[n] : t[n];
+
+            float r[4];
+            float length = 0;
+            for (int i = 0; i < 4; i++) {
+                r[i] = s * a[i] + u * b[i];
+                length += r[i] * r[i];
+            }
+
+            const float inv = 1 / std::sqrt(length);
+            for (int i = 0; i < 4; i++) {
+                out[i] = r[i] * inv;
+            }
+        }
+    }
+
+    // Weight sin(t θ) / sin θ of the polynomial approximation, evaluated with xm1 = cos θ - 1.
+    static float slerp_coefficient(const float t, const float xm1) {
+        const float tt = t * t;
+        float acc = 1;
+        for (int i = 7; i >= 0; i--) {
+            acc = 1 + (slerp_u[i] * tt - slerp_v[i]) * xm1 * acc;
+        }
+        return t * acc;
+    }
+
+    void quaternion_slerp_fast(const float *a, const float *b, const float *t, float *out, const size_t count) {
+        for (size_t n = 0; n < count; n++, a += 4, b += 4, out += 4) {
+            const float d = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+
+            const float xm1 = std::abs(d) - 1;
+            const float s = slerp_coefficient(1 - t[n], xm1);
+            const float u = d < 0 ? -slerp_coefficient(t[n], xm1) : slerp_coefficient(t[n], xm1);
+
+            for (int i = 0; i < 4; i++) {
+                out[i] = s * a[i] + u * b[i];
+            }
+        }
+    }
+
+    // Rotation matrix rows of the unit quaternion (x, y, z, w), acting on column vectors.
+    static void rotation_matrix(const float *q, float (&m)[3][3]) {
+        const float x2 = q[0] + q[0];
+        const float y2 = q[1] + q[1];
+        const float z2 = q[2] + q[2];
+
+        const float xx = q[0] * x2, yy = q[1] * y2, zz = q[2] * z2;
+        const float xy = q[0] * y2, xz = q[0] * z2, yz = q[1] * z2;
+        const float wx = q[3] * x2, wy = q[3] * y2, wz = q[3] * z2;
+
+        m[0][0] = 1 - (yy + zz);
+        m[0][1] = xy - wz;
+        m[0][2] = xz + wy;
+        m[1][0] = xy + wz;
+        m[1][1] = 1 - (xx + zz);
+        m[1][2] = yz - wx;
+        m[2][0] = xz - wy;
+        m[2][1] = yz + wx;
+        m[2][2] = 1 - (xx + yy);
+    }
+
+    void quaternion_to_matrix3(const float *q, float *out, const size_t count) {
+        for (size_t n = 0; n < count; n++, q += 4, out += 9) {
+            float m[3][3];
+            rotation_matrix(q, m);
+            for (int i = 0; i < 3; i++) {
+                for (int j = 0; j < 3; j++) {
+                    out[3 * i + j] = m[i][j];
+                }
+            }
+        }
+    }
+
+    void quaternion_to_matrix34(const float *q, float *out, const size_t count) {
+        for (size_t n = 0; n < count; n++, q += 4, out += 12) {
+            float m[3][3];
+            rotation_matrix(q, m);
+            for (int i = 0; i < 3; i++) {
+                for (int j = 0; j < 3; j++) {
+                    out[4 * i + j] = m[i][j];
+                }
+                out[4 * i + 3] = 0;
+            }
+        }
+    }
+}
@@ -0,0 +1,52 @@
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+namespace EngineM::kernels::scalar {
+    void reduce_bounds(const float *xyz, const size_t count, float *min, float *max) {
+        for (int c = 0; c < 3; c++) {
+            min[c] = std::numeric_limits<float>::infinity();
+            max[c] = -std::numeric_limits<float>::infinity();
+        }
+        for (size_t n = 0; n < count; n++, xyz += 3) {
+            for (int c = 0; c < 3; c++) {
+                min[c] = std::min(min[c], xyz[c]);
+                max[c] = std::max(max[c], xyz[c]);
+            }
+        }
+    }
+
+    void reduce_sum(const float *xyz, const size_t count, float *sum) {
+        sum[0] = sum[1] = sum[2] = 0;
+        for (size_t n = 0; n < count; n++, xyz += 3) {
+            sum[0] += xyz[0];
+            sum[1] += xyz[1];
+            sum[2] += xyz[2];
+        }
+    }
+
+    void reduce_covariance(const float *xyz, const size_t count, const float *centre, float *out) {
+        std::fill_n(out, 6, 0.0f);
+        for (size_t n = 0; n < count; n++, xyz += 3) {
+            const float x = xyz[0] - centre[0];
+            const float y = xyz[1] - centre[1];
+            const float z = xyz[2] - centre[2];
+            out[0] += x * x;
+            out[1] += x * y;
+            out[2] += x * z;
+            out[3] += y * y;
+            out[4] += y * z;
+            out[5] += z * z;
+        }
+    }
+
+    void reduce_dot_range(const float *xyz, const size_t count, const float *direction, float *min, float *max) {
+        *min = std::numeric_limits<float>::infinity();
+        *max = -std::numeric_limits<float>::infinity();
+        for (size_t n = 0; n < count; n++, xyz += 3) {
+            const float d = xyz[0] * direction[0] + xyz[1] * direction[1] + xyz[2] * direction[2];
+            *min = std::min(*min, d);
+            *max = std::max(*max, d);
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "kernels/kernel_declarations.h"
+
+namespace EngineM::kernels::scalar {
+    void dual_quaternion_blend(const float *bones, const int32_t *joints, const float *weights, float *out, const size_t stride, const size_t count) {
+        for (size_t n = 0; n < count; n++, joints += 4, weights += 4) {
+            const float *first = bones + 8 * joints[0];
+
+            float acc[8] = {};
+            for (int s = 0; s < 4; s++) {
+                const float *b = bones + 8 * joints[s];
+
+                // Bones whose rotation lies in the opposite hemisphere to the first bone's are
+                // negated so the blend takes the shorter path.
+                const float d = first[0] * b[0] + first[1] * b[1] + first[2] * b[2] + first[3] * b[3];
+                const float w = d < 0 ? -weights[s] : weights[s];
+                for (int k = 0; k < 8; k++) {
+                    acc[k] += w * b[k];
+                }
+            }
+
+            const float inv = 1 / std::sqrt(acc[0] * acc[0] + acc[1] * acc[1] + acc[2] * acc[2] + acc[3] * acc[3]);
+            for (int k = 0; k < 8; k++) {
+                out[k * stride + n] = acc[k] * inv;
+            }
+        }
+    }
+
+    // Rotates by the real part and, for points, adds the translation 2 (d r*).v, written out
+    // as 2 (rw dv - dw rv + rv x dv).
+    template <bool translate>
+    static void dual_quaternion_transform(const float *dq, const size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, const size_t count) {
+        for (size_t n = 0; n < count; n++) {
+            const float rx = dq[n], ry = dq[stride + n], rz = dq[2 * stride + n], rw = dq[3 * stride + n];
+            const float px = x[n], py = y[n], pz = z[n];
+
+            const float ux = 2 * (ry * pz - rz * py);
+            const float uy = 2 * (rz * px - rx * pz);
+            const float uz = 2 * (rx * py - ry * px);
+
+            float qx = px + rw * ux + (ry * uz - rz * uy);
+            float qy = py + rw * uy + (rz * ux - rx * uz);
+            float qz = pz + rw * uz + (rx * uy - ry * ux);
+
+            if constexpr (translate) {
+                const float dx = dq[4 * stride + n], dy = dq[5 * stride + n], dz = dq[6 * stride + n], dw = dq[7 * stride + n];
+                qx += 2 * (rw * dx - dw * rx + (ry * dz - rz * dy));
+                qy += 2 * (rw * dy - dw * ry + (rz * dx - rx * dz));
+                qz += 2 * (rw * dz - dw * rz + (rx * dy - ry * dx));
+            }
+
+            outX[n] = qx;
+            outY[n] = qy;
+            outZ[n] = qz;
+        }
+    }
+
+    void dual_quaternion_transform_points(const float *dq, const size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, const size_t count) {
+        dual_quaternion_transform<true>(dq, stride, x, y, z, outX, outY, outZ, count);
+    }
+
+    void dual_quaternion_transform_vectors(const float *dq, const size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, const size_t count) {
+        dual_quaternion_transform<false>(dq, stride, x, y, z, outX, outY, outZ, count);
+    }
+}
@@ -0,0 +1,25 @@
+#include <cstddef>
+
+namespace EngineM::kernels::scalar {
+    void transform_aos(const float (&m)[3][4], const float *in, float *out, const size_t count) {
+        for (size_t n = 0; n < count; n++, in += 3, out += 3) {
+            const float x = in[0];
+            const float y = in[1];
+            const float z = in[2];
+            out[0] = m[0][0] * x + m[0][1] * y + m[0][2] * z + m[0][3];
+            out[1] = m[1][0] * x + m[1][1] * y + m[1][2] * z + m[1][3];
+            out[2] = m[2][0] * x + m[2][1] * y + m[2][2] * z + m[2][3];
+        }
+    }
+
+    void transform_soa(const float (&m)[3][4], const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, const size_t count) {
+        for (size_t n = 0; n < count; n++) {
+            const float px = x[n];
+            const float py = y[n];
+            const float pz = z[n];
+            outX[n] = m[0][0] * px + m[0][1] * py + m[0][2] * pz + m[0][3];
+            outY[n] = m[1][0] * px + m[1][1] * py + m[1][2] * pz + m[1][3];
+            outZ[n] = m[2][0] * px + m[2][1] * py + m[2][2] * pz + m[2][3];
+        }
+    }
+}
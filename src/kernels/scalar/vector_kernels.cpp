@@ -0,0 +1,61 @@
+#include <cmath>
+#include <cstddef>
+
+namespace EngineM::kernels::scalar {
+    void soa_dot(const float *ax, const float *ay, const float *az, const float *bx, const float *by, const float *bz, float *out, const size_t count) {
+        for (size_t n = 0; n < count; n++) {
+            out[n] = ax[n] * bx[n] + ay[n] * by[n] + az[n] * bz[n];
+        }
+    }
+
+    void soa_cross(const float *ax, const float *ay, const float *az, const float *bx, const float *by, const float *bz, float *outX, float *outY, float *outZ, const size_t count) {
+        for (size_t n = 0; n < count; n++) {
+            const float x = ay[n] * bz[n] - az[n] * by[n];
+            const float y = az[n] * bx[n] - ax[n] * bz[n];
+            const float z = ax[n] * by[n] - ay[n] * bx[n];
+            outX[n] = x;
+            outY[n] = y;
+            outZ[n] = z;
+        }
+    }
+
+    void soa_length(const float *x, const float *y, const float *z, float *out, const size_t count) {
+        for (size_t n = 0; n < count; n++) {
+            out[n] = std::sqrt(x[n] * x[n] + y[n] * y[n] + z[n] * z[n]);
+        }
+    }
+
+    void soa_normalise(const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, const size_t count) {
+        for (size_t n = 0; n < count; n++) {
+            const float px = x[n];
+            const float py = y[n];
+            const float pz = z[n];
+            const float length = std::sqrt(px * px + py * py + pz * pz);
+            if (length > 0) {
+                outX[n] = px / length;
+                outY[n] = py / length;
+                outZ[n] = pz / length;
+            } else {
+                outX[n] = px;
+                outY[n] = py;
+                outZ[n] = pz;
+            }
+        }
+    }
+
+    void interleave3(const float *x, const float *y, const float *z, float *xyz, const size_t count) {
+        for (size_t n = 0; n < count; n++, xyz += 3) {
+            xyz[0] = x[n];
+            xyz[1] = y[n];
+            xyz[2] = z[n];
+        }
+    }
+
+    void deinterleave3(const float *xyz, float *x, float *y, float *z, const size_t count) {
+        for (size_t n = 0; n < count; n++, xyz += 3) {
+            x[n] = xyz[0];
+            y[n] = xyz[1];
+            z[n] = xyz[2];
+        }
+    }
+}
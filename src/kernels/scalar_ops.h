@@ -0,0 +1,29 @@
+#pragma once
+
+#include <immintrin.h>
+#include <limits>
+
+// Scalar helpers for the kernel directories built with extra instruction set flags. Inline
+// library functions such as std::min or std::fma are emitted there as weak symbols compiled
+// for that instruction set, and the linker may then hand that copy to the baseline kernels
+// too. These are static, so each file keeps its own copy.
+namespace EngineM::kernels {
+    // Constant initialised, so no call to numeric_limits is emitted.
+    inline constexpr float infinity = std::numeric_limits<float>::infinity();
+
+    // Same results as std::min and std::max, including which operand a NaN comparison keeps.
+    static inline float min_ss(const float a, const float b) {
+        return _mm_cvtss_f32(_mm_min_ss(_mm_set_ss(b), _mm_set_ss(a)));
+    }
+
+    static inline float max_ss(const float a, const float b) {
+        return _mm_cvtss_f32(_mm_max_ss(_mm_set_ss(b), _mm_set_ss(a)));
+    }
+
+#ifdef __FMA__
+    // a * b + c with a single rounding.
+    static inline float fmadd_ss(const float a, const float b, const float c) {
+        return _mm_cvtss_f32(_mm_fmadd_ss(_mm_set_ss(a), _mm_set_ss(b), _mm_set_ss(c)));
+    }
+#endif
+}
@@ -0,0 +1,102 @@
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+#include "kernels/kernel_declarations.h"
+#include "kernels/xyz_shuffle.h"
+
+namespace EngineM::kernels::sse {
+    static __m128 abs(const __m128 v) {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), v);
+    }
+
+    static __m128 select(const __m128 mask, const __m128 a, const __m128 b) {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    static __m128i to_snorm16(const __m128 v) {
+        return _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(v, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f)), _mm_set1_ps(32767.0f)));
+    }
+
+    static __m128 from_snorm16(const __m128i v) {
+        return _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(v), _mm_set1_ps(1.0f / 32767.0f)), _mm_set1_ps(-1.0f));
+    }
+
+    void snorm16_encode(const float *in, int16_t *out, const size_t n) {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m128i lo = to_snorm16(_mm_loadu_ps(in + i));
+            const __m128i hi = to_snorm16(_mm_loadu_ps(in + i + 4));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_packs_epi32(lo, hi));
+        }
+        scalar::snorm16_encode(in + i, out + i, n - i);
+    }
+
+    void snorm16_decode(const int16_t *in, float *out, const size_t n) {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+            // Sign-extend to 32 bits by placing each value in the high half and shifting back.
+            _mm_storeu_ps(out + i, from_snorm16(_mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16)));
+            _mm_storeu_ps(out + i + 4, from_snorm16(_mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16)));
+        }
+        scalar::snorm16_decode(in + i, out + i, n - i);
+    }
+
+    void octahedral_encode(const float *xyz, int16_t *out, const size_t count) {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 minusOne = _mm_set1_ps(-1.0f);
+
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4, xyz += 12, out += 8) {
+            __m128 x, y, z;
+            load_xyz(xyz, x, y, z);
+
+            const __m128 sum = _mm_add_ps(_mm_add_ps(abs(x), abs(y)), abs(z));
+            const __m128 k = _mm_and_ps(_mm_div_ps(one, sum), _mm_cmpgt_ps(sum, zero));
+            const __m128 u = _mm_mul_ps(x, k);
+            const __m128 v = _mm_mul_ps(y, k);
+
+            // Fold the lower hemisphere over the diagonals.
+            const __m128 foldedU = _mm_mul_ps(_mm_sub_ps(one, abs(v)), select(_mm_cmpge_ps(u, zero), one, minusOne));
+            const __m128 foldedV = _mm_mul_ps(_mm_sub_ps(one, abs(u)), select(_mm_cmpge_ps(v, zero), one, minusOne));
+            const __m128 lower = _mm_cmplt_ps(z, zero);
+
+            const __m128i su = to_snorm16(select(lower, foldedU, u));
+            const __m128i sv = to_snorm16(select(lower, foldedV, v));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_packs_epi32(_mm_unpacklo_epi32(su, sv), _mm_unpackhi_epi32(su, sv)));
+        }
+        scalar::octahedral_encode(xyz, out, count - n);
+    }
+
+    void octahedral_decode(const int16_t *in, float *xyz, const size_t count) {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4, in += 8, xyz += 12) {
+            const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+            const __m128 lo = from_snorm16(_mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16));
+            const __m128 hi = from_snorm16(_mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16));
+
+            __m128 u = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+            __m128 v = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+            const __m128 z = _mm_sub_ps(_mm_sub_ps(one, abs(u)), abs(v));
+            const __m128 t = _mm_max_ps(_mm_sub_ps(zero, z), zero);
+            const __m128 negT = _mm_sub_ps(zero, t);
+
+            u = _mm_add_ps(u, select(_mm_cmpge_ps(u, zero), negT, t));
+            v = _mm_add_ps(v, select(_mm_cmpge_ps(v, zero), negT, t));
+
+            const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(u, u), _mm_mul_ps(v, v)), _mm_mul_ps(z, z)));
+            const __m128 px = _mm_div_ps(u, length);
+            const __m128 py = _mm_div_ps(v, length);
+            const __m128 pz = _mm_div_ps(z, length);
+
+            store_xyz(xyz, px, py, pz);
+        }
+        scalar::octahedral_decode(in, xyz, count - n);
+    }
+}
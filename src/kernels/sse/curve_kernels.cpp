@@ -0,0 +1,55 @@
+#include <cstddef>
+#include <immintrin.h>
+
+#include "kernels/xyz_shuffle.h"
+
+namespace EngineM::kernels::sse {
+    void lerp(const float *a, const float *b, const float t, float *out, const size_t n) {
+        const float one_minus_t = 1 - t;
+        const __m128 tv = _mm_set1_ps(t);
+        const __m128 one_minus_tv = _mm_set1_ps(one_minus_t);
+
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            _mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a + i), one_minus_tv), _mm_mul_ps(_mm_loadu_ps(b + i), tv)));
+        }
+        for (; i < n; i++) {
+            out[i] = a[i] * one_minus_t + b[i] * t;
+        }
+    }
+
+    void polynomial(const float *coefficients, const size_t degree, const float *t, float *out, const size_t count) {
+        const float *last = coefficients + 3 * degree;
+
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4, out += 12) {
+            const __m128 tv = _mm_loadu_ps(t + n);
+            __m128 x = _mm_set1_ps(last[0]);
+            __m128 y = _mm_set1_ps(last[1]);
+            __m128 z = _mm_set1_ps(last[2]);
+
+            for (const float *c = last; c != coefficients;) {
+                c -= 3;
+                x = _mm_add_ps(_mm_mul_ps(x, tv), _mm_set1_ps(c[0]));
+                y = _mm_add_ps(_mm_mul_ps(y, tv), _mm_set1_ps(c[1]));
+                z = _mm_add_ps(_mm_mul_ps(z, tv), _mm_set1_ps(c[2]));
+            }
+
+            store_xyz(out, x, y, z);
+        }
+        for (; n < count; n++, out += 3) {
+            float x = last[0];
+            float y = last[1];
+            float z = last[2];
+            for (const float *c = last; c != coefficients;) {
+                c -= 3;
+                x = x * t[n] + c[0];
+                y = y * t[n] + c[1];
+                z = z * t[n] + c[2];
+            }
+            out[0] = x;
+            out[1] = y;
+            out[2] = z;
+        }
+    }
+}
@@ -1,3 +1,5 @@
+#include <cstddef>
+#include <cstdint>
 #include <immintrin.h>
 
 namespace EngineM::kernels::sse {
@@ -10,8 +12,8 @@ namespace EngineM::kernels::sse {
         const __m128 output1 = _mm_add_ps(first, third);
         const __m128 output2 = _mm_add_ps(second, fourth);
 
-        _mm_store_ps(&out[0][0], output1);
-        _mm_store_ps(&out[1][1], output2);
+        _mm_storeu_ps(&out[0][0], output1);
+        _mm_storeu_ps(&out[1][1], output2);
         out[2][2] = a[2][2] + b[2][2];
     }
 
@@ -24,8 +26,8 @@ namespace EngineM::kernels::sse {
         const __m128 output1 = _mm_sub_ps(first, third);
         const __m128 output2 = _mm_sub_ps(second, fourth);
 
-        _mm_store_ps(&out[0][0], output1);
-        _mm_store_ps(&out[1][1], output2);
+        _mm_storeu_ps(&out[0][0], output1);
+        _mm_storeu_ps(&out[1][1], output2);
         out[2][2] = a[2][2] - b[2][2];
     }
 
@@ -37,8 +39,8 @@ namespace EngineM::kernels::sse {
         const __m128 output1 = _mm_mul_ps(first, third);
         const __m128 output2 = _mm_mul_ps(second, third);
 
-        _mm_store_ps(&out[0][0], output1);
-        _mm_store_ps(&out[1][1], output2);
+        _mm_storeu_ps(&out[0][0], output1);
+        _mm_storeu_ps(&out[1][1], output2);
         out[2][2] = a[2][2] * k;
     }
 
@@ -60,7 +62,7 @@ namespace EngineM::kernels::sse {
         const __m128 m21 = _mm_mul_ps(row2, col1);
         const __m128 m22 = _mm_mul_ps(row2, col2);
 
-        float arr1[4], arr2[4], arr3[4], arr4[4], arr5[4], arr6[4], arr7[4], arr8[4], arr9[4];
+        alignas(16) float arr1[4], arr2[4], arr3[4], arr4[4], arr5[4], arr6[4], arr7[4], arr8[4], arr9[4];
 
         _mm_store_ps(arr1, m00);
         _mm_store_ps(arr2, m01);
@@ -82,4 +84,88 @@ namespace EngineM::kernels::sse {
         out[2][1] = arr8[0] + arr8[1] + arr8[2];
         out[2][2] = arr9[0] + arr9[1] + arr9[2];
     }
-}
\ No newline at end of file
+
+    void array_add(const float *a, const float *b, float *out, const size_t n) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        }
+        for (; i < n; i++) {
+            out[i] = a[i] + b[i];
+        }
+    }
+
+    void array_sub(const float *a, const float *b, float *out, const size_t n) {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            _mm_storeu_ps(out + i, _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        }
+        for (; i < n; i++) {
+            out[i] = a[i] - b[i];
+        }
+    }
+
+    void array_mul_by_k(const float *a, const float k, float *out, const size_t n) {
+        const __m128 factor = _mm_set1_ps(k);
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            _mm_storeu_ps(out + i, _mm_mul_ps(_mm_loadu_ps(a + i), factor));
+        }
+        for (; i < n; i++) {
+            out[i] = a[i] * k;
+        }
+    }
+
+    // Loads a row of three floats without reading past it; lane 3 is zero.
+    static __m128 load_row(const float *row) {
+        return _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double *>(row))), _mm_load_ss(row + 2));
+    }
+
+    void matrix_mul_aos(const float *a, const float *b, float *out, const size_t count) {
+        for (size_t n = 0; n < count; n++, a += 9, b += 9, out += 9) {
+            const __m128 b0 = load_row(b);
+            const __m128 b1 = load_row(b + 3);
+            const __m128 b2 = load_row(b + 6);
+
+            const __m128 r0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(a[0]), b0), _mm_mul_ps(_mm_set1_ps(a[1]), b1)), _mm_mul_ps(_mm_set1_ps(a[2]), b2));
+            const __m128 r1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(a[3]), b0), _mm_mul_ps(_mm_set1_ps(a[4]), b1)), _mm_mul_ps(_mm_set1_ps(a[5]), b2));
+            const __m128 r2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(a[6]), b0), _mm_mul_ps(_mm_set1_ps(a[7]), b1)), _mm_mul_ps(_mm_set1_ps(a[8]), b2));
+
+            // Rows are stored in order so each one overwrites the spare lane of the previous.
+            _mm_storeu_ps(out, r0);
+            _mm_storeu_ps(out + 3, r1);
+            _mm_storel_pi(reinterpret_cast<__m64 *>(out + 6), r2);
+            _mm_store_ss(out + 8, _mm_movehl_ps(r2, r2));
+        }
+    }
+
+    void matrix_mul_soa(const float *a, const float *b, float *out, const size_t stride, const size_t count) {
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4) {
+            __m128 x[9], y[9];
+            for (uint32_t e = 0; e < 9; e++) {
+                x[e] = _mm_loadu_ps(a + e * stride + n);
+                y[e] = _mm_loadu_ps(b + e * stride + n);
+            }
+            for (uint32_t i = 0; i < 3; i++) {
+                for (uint32_t j = 0; j < 3; j++) {
+                    const __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x[i * 3], y[j]), _mm_mul_ps(x[i * 3 + 1], y[3 + j])), _mm_mul_ps(x[i * 3 + 2], y[6 + j]));
+                    _mm_storeu_ps(out + (i * 3 + j) * stride + n, r);
+                }
+            }
+        }
+        for (; n < count; n++) {
+            float result[9];
+            for (uint32_t i = 0; i < 3; i++) {
+                for (uint32_t j = 0; j < 3; j++) {
+                    result[i * 3 + j] = a[(i * 3) * stride + n] * b[j * stride + n]
+                        + a[(i * 3 + 1) * stride + n] * b[(3 + j) * stride + n]
+                        + a[(i * 3 + 2) * stride + n] * b[(6 + j) * stride + n];
+                }
+            }
+            for (uint32_t e = 0; e < 9; e++) {
+                out[e * stride + n] = result[e];
+            }
+        }
+    }
+}
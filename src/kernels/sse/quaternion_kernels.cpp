@@ -0,0 +1,172 @@
+#include <cstddef>
+#include <immintrin.h>
+
+#include "kernels/kernel_declarations.h"
+#include "kernels/xyz_shuffle.h"
+
+namespace EngineM::kernels::sse {
+    static void load_quaternions(const float *q, __m128 &x, __m128 &y, __m128 &z, __m128 &w) {
+        x = _mm_loadu_ps(q);
+        y = _mm_loadu_ps(q + 4);
+        z = _mm_loadu_ps(q + 8);
+        w = _mm_loadu_ps(q + 12);
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+    }
+
+    static void store_quaternions(float *q, __m128 x, __m128 y, __m128 z, __m128 w) {
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+        _mm_storeu_ps(q, x);
+        _mm_storeu_ps(q + 4, y);
+        _mm_storeu_ps(q + 8, z);
+        _mm_storeu_ps(q + 12, w);
+    }
+
+    void quaternion_rotate(const float *q, const float *in, float *out, const size_t count) {
+        const __m128 two = _mm_set1_ps(2.0f);
+
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4, q += 16, in += 12, out += 12) {
+            __m128 qx, qy, qz, qw;
+            load_quaternions(q, qx, qy, qz, qw);
+
+            __m128 x, y, z;
+            load_xyz(in, x, y, z);
+
+            const __m128 tx = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qy, z), _mm_mul_ps(qz, y)));
+            const __m128 ty = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qz, x), _mm_mul_ps(qx, z)));
+            const __m128 tz = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qx, y), _mm_mul_ps(qy, x)));
+
+            const __m128 px = _mm_add_ps(_mm_add_ps(x, _mm_mul_ps(qw, tx)), _mm_sub_ps(_mm_mul_ps(qy, tz), _mm_mul_ps(qz, ty)));
+            const __m128 py = _mm_add_ps(_mm_add_ps(y, _mm_mul_ps(qw, ty)), _mm_sub_ps(_mm_mul_ps(qz, tx), _mm_mul_ps(qx, tz)));
+            const __m128 pz = _mm_add_ps(_mm_add_ps(z, _mm_mul_ps(qw, tz)), _mm_sub_ps(_mm_mul_ps(qx, ty), _mm_mul_ps(qy, tx)));
+
+            store_xyz(out, px, py, pz);
+        }
+        scalar::quaternion_rotate(q, in, out, count - n);
+    }
+
+    void quaternion_nlerp(const float *a, const float *b, const float *t, float *out, const size_t count) {
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 sign = _mm_set1_ps(-0.0f);
+
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4, a += 16, b += 16, out += 16) {
+            __m128 ax, ay, az, aw, bx, by, bz, bw;
+            load_quaternions(a, ax, ay, az, aw);
+            load_quaternions(b, bx, by, bz, bw);
+
+            const __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+
+            // Flipping the sign of t where the dot product is negative takes the shorter arc.
+            const __m128 tn = _mm_loadu_ps(t + n);
+            const __m128 s = _mm_sub_ps(one, tn);
+            const __m128 u = _mm_xor_ps(tn, _mm_and_ps(d, sign));
+
+            const __m128 rx = _mm_add_ps(_mm_mul_ps(s, ax), _mm_mul_ps(u, bx));
+            const __m128 ry = _mm_add_ps(_mm_mul_ps(s, ay), _mm_mul_ps(u, by));
+            const __m128 rz = _mm_add_ps(_mm_mul_ps(s, az), _mm_mul_ps(u, bz));
+            const __m128 rw = _mm_add_ps(_mm_mul_ps(s, aw), _mm_mul_ps(u, bw));
+
+            const __m128 length = _mm_add_ps(_mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry)), _mm_add_ps(_mm_mul_ps(rz, rz), _mm_mul_ps(rw, rw)));
+            const __m128 inv = _mm_div_ps(one, _mm_sqrt_ps(length));
+
+            store_quaternions(out, _mm_mul_ps(rx, inv), _mm_mul_ps(ry, inv), _mm_mul_ps(rz, inv), _mm_mul_ps(rw, inv));
+        }
+        scalar::quaternion_nlerp(a, b, t + n, out, count - n);
+    }
+
+    static __m128 slerp_coefficient(const __m128 t, const __m128 xm1) {
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 tt = _mm_mul_ps(t, t);
+        __m128 acc = one;
+        for (int i = 7; i >= 0; i--) {
+            const __m128 c = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(slerp_u[i]), tt), _mm_set1_ps(slerp_v[i]));
+            acc = _mm_add_ps(one, _mm_mul_ps(_mm_mul_ps(c, xm1), acc));
+        }
+        return _mm_mul_ps(t, acc);
+    }
+
+    void quaternion_slerp_fast(const float *a, const float *b, const float *t, float *out, const size_t count) {
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 sign = _mm_set1_ps(-0.0f);
+
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4, a += 16, b += 16, out += 16) {
+            __m128 ax, ay, az, aw, bx, by, bz, bw;
+            load_quaternions(a, ax, ay, az, aw);
+            load_quaternions(b, bx, by, bz, bw);
+
+            const __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+            const __m128 xm1 = _mm_sub_ps(_mm_andnot_ps(sign, d), one);
+
+            const __m128 tn = _mm_loadu_ps(t + n);
+            const __m128 s = slerp_coefficient(_mm_sub_ps(one, tn), xm1);
+            const __m128 u = _mm_xor_ps(slerp_coefficient(tn, xm1), _mm_and_ps(d, sign));
+
+            store_quaternions(out,
+                _mm_add_ps(_mm_mul_ps(s, ax), _mm_mul_ps(u, bx)),
+                _mm_add_ps(_mm_mul_ps(s, ay), _mm_mul_ps(u, by)),
+                _mm_add_ps(_mm_mul_ps(s, az), _mm_mul_ps(u, bz)),
+                _mm_add_ps(_mm_mul_ps(s, aw), _mm_mul_ps(u, bw)));
+        }
+        scalar::quaternion_slerp_fast(a, b, t + n, out, count - n);
+    }
+
+    // Rotation matrices of four quaternions, transposed back so rows[k][i] holds row i of
+    // quaternion k as (m_i0, m_i1, m_i2, 0).
+    static void rotation_rows(const float *q, __m128 (&rows)[4][3]) {
+        __m128 x, y, z, w;
+        load_quaternions(q, x, y, z, w);
+
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 x2 = _mm_add_ps(x, x);
+        const __m128 y2 = _mm_add_ps(y, y);
+        const __m128 z2 = _mm_add_ps(z, z);
+
+        const __m128 xx = _mm_mul_ps(x, x2), yy = _mm_mul_ps(y, y2), zz = _mm_mul_ps(z, z2);
+        const __m128 xy = _mm_mul_ps(x, y2), xz = _mm_mul_ps(x, z2), yz = _mm_mul_ps(y, z2);
+        const __m128 wx = _mm_mul_ps(w, x2), wy = _mm_mul_ps(w, y2), wz = _mm_mul_ps(w, z2);
+
+        __m128 m[3][4] = {
+            {_mm_sub_ps(one, _mm_add_ps(yy, zz)), _mm_sub_ps(xy, wz), _mm_add_ps(xz, wy), _mm_setzero_ps()},
+            {_mm_add_ps(xy, wz), _mm_sub_ps(one, _mm_add_ps(xx, zz)), _mm_sub_ps(yz, wx), _mm_setzero_ps()},
+            {_mm_sub_ps(xz, wy), _mm_add_ps(yz, wx), _mm_sub_ps(one, _mm_add_ps(xx, yy)), _mm_setzero_ps()}
+        };
+        for (int i = 0; i < 3; i++) {
+            _MM_TRANSPOSE4_PS(m[i][0], m[i][1], m[i][2], m[i][3]);
+            for (int k = 0; k < 4; k++) {
+                rows[k][i] = m[i][k];
+            }
+        }
+    }
+
+    void quaternion_to_matrix3(const float *q, float *out, const size_t count) {
+        size_t n = 0;
+        // Each row is stored as four floats, the fourth landing on the first element of the
+        // next row. The loop stops one matrix early so that element is always written later.
+        for (; n + 4 < count; n += 4, q += 16, out += 36) {
+            __m128 rows[4][3];
+            rotation_rows(q, rows);
+            for (int k = 0; k < 4; k++) {
+                for (int i = 0; i < 3; i++) {
+                    _mm_storeu_ps(out + 9 * k + 3 * i, rows[k][i]);
+                }
+            }
+        }
+        scalar::quaternion_to_matrix3(q, out, count - n);
+    }
+
+    void quaternion_to_matrix34(const float *q, float *out, const size_t count) {
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4, q += 16, out += 48) {
+            __m128 rows[4][3];
+            rotation_rows(q, rows);
+            for (int k = 0; k < 4; k++) {
+                for (int i = 0; i < 3; i++) {
+                    _mm_storeu_ps(out + 12 * k + 4 * i, rows[k][i]);
+                }
+            }
+        }
+        scalar::quaternion_to_matrix34(q, out, count - n);
+    }
+}
@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <cstddef>
+#include <immintrin.h>
+#include <limits>
+
+#include "kernels/kernel_declarations.h"
+#include "kernels/xyz_shuffle.h"
+
+namespace EngineM::kernels::sse {
+    static float sum(const __m128 v) {
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, v);
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+
+    // Bounds and sums work on the interleaved floats directly: three registers cover four
+    // points, and float i of the block always belongs to component i % 3.
+    void reduce_bounds(const float *xyz, const size_t count, float *min, float *max) {
+        __m128 lo[3];
+        __m128 hi[3];
+        for (int r = 0; r < 3; r++) {
+            lo[r] = _mm_set1_ps(std::numeric_limits<float>::infinity());
+            hi[r] = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+        }
+
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4, xyz += 12) {
+            for (int r = 0; r < 3; r++) {
+                const __m128 v = _mm_loadu_ps(xyz + 4 * r);
+                lo[r] = _mm_min_ps(lo[r], v);
+                hi[r] = _mm_max_ps(hi[r], v);
+            }
+        }
+        scalar::reduce_bounds(xyz, count - n, min, max);
+
+        alignas(16) float l[12];
+        alignas(16) float h[12];
+        for (int r = 0; r < 3; r++) {
+            _mm_store_ps(l + 4 * r, lo[r]);
+            _mm_store_ps(h + 4 * r, hi[r]);
+        }
+        for (int i = 0; i < 12; i++) {
+            min[i % 3] = std::min(min[i % 3], l[i]);
+            max[i % 3] = std::max(max[i % 3], h[i]);
+        }
+    }
+
+    void reduce_sum(const float *xyz, const size_t count, float *out) {
+        __m128 acc[3] = {_mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps()};
+
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4, xyz += 12) {
+            for (int r = 0; r < 3; r++) {
+                acc[r] = _mm_add_ps(acc[r], _mm_loadu_ps(xyz + 4 * r));
+            }
+        }
+        scalar::reduce_sum(xyz, count - n, out);
+
+        alignas(16) float s[12];
+        for (int r = 0; r < 3; r++) {
+            _mm_store_ps(s + 4 * r, acc[r]);
+        }
+        for (int i = 0; i < 12; i++) {
+            out[i % 3] += s[i];
+        }
+    }
+
+    void reduce_covariance(const float *xyz, const size_t count, const float *centre, float *out) {
+        const __m128 cx = _mm_set1_ps(centre[0]);
+        const __m128 cy = _mm_set1_ps(centre[1]);
+        const __m128 cz = _mm_set1_ps(centre[2]);
+        __m128 acc[6];
+        for (__m128 &a : acc) {
+            a = _mm_setzero_ps();
+        }
+
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4, xyz += 12) {
+            __m128 x, y, z;
+            load_xyz(xyz, x, y, z);
+            x = _mm_sub_ps(x, cx);
+            y = _mm_sub_ps(y, cy);
+            z = _mm_sub_ps(z, cz);
+
+            acc[0] = _mm_add_ps(acc[0], _mm_mul_ps(x, x));
+            acc[1] = _mm_add_ps(acc[1], _mm_mul_ps(x, y));
+            acc[2] = _mm_add_ps(acc[2], _mm_mul_ps(x, z));
+            acc[3] = _mm_add_ps(acc[3], _mm_mul_ps(y, y));
+            acc[4] = _mm_add_ps(acc[4], _mm_mul_ps(y, z));
+            acc[5] = _mm_add_ps(acc[5], _mm_mul_ps(z, z));
+        }
+        scalar::reduce_covariance(xyz, count - n, centre, out);
+
+        for (int i = 0; i < 6; i++) {
+            out[i] += sum(acc[i]);
+        }
+    }
+
+    void reduce_dot_range(const float *xyz, const size_t count, const float *direction, float *min, float *max) {
+        const __m128 dx = _mm_set1_ps(direction[0]);
+        const __m128 dy = _mm_set1_ps(direction[1]);
+        const __m128 dz = _mm_set1_ps(direction[2]);
+        __m128 lo = _mm_set1_ps(std::numeric_limits<float>::infinity());
+        __m128 hi = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4, xyz += 12) {
+            __m128 x, y, z;
+            load_xyz(xyz, x, y, z);
+            const __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, dx), _mm_mul_ps(y, dy)), _mm_mul_ps(z, dz));
+            lo = _mm_min_ps(lo, d);
+            hi = _mm_max_ps(hi, d);
+        }
+        scalar::reduce_dot_range(xyz, count - n, direction, min, max);
+
+        alignas(16) float l[4];
+        alignas(16) float h[4];
+        _mm_store_ps(l, lo);
+        _mm_store_ps(h, hi);
+        for (int i = 0; i < 4; i++) {
+            *min = std::min(*min, l[i]);
+            *max = std::max(*max, h[i]);
+        }
+    }
+}
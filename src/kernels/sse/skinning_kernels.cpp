@@ -0,0 +1,108 @@
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+#include "kernels/kernel_declarations.h"
+
+namespace EngineM::kernels::sse {
+    // Fetches the dual quaternion of the given influence slot for four vertices and
+    // transposes it into component registers: c[0..3] real (x, y, z, w), c[4..7] dual.
+    static void load_bones(const float *bones, const int32_t *joints, const int slot, __m128 (&c)[8]) {
+        for (int half = 0; half < 8; half += 4) {
+            c[half] = _mm_loadu_ps(bones + 8 * joints[slot] + half);
+            c[half + 1] = _mm_loadu_ps(bones + 8 * joints[4 + slot] + half);
+            c[half + 2] = _mm_loadu_ps(bones + 8 * joints[8 + slot] + half);
+            c[half + 3] = _mm_loadu_ps(bones + 8 * joints[12 + slot] + half);
+            _MM_TRANSPOSE4_PS(c[half], c[half + 1], c[half + 2], c[half + 3]);
+        }
+    }
+
+    void dual_quaternion_blend(const float *bones, const int32_t *joints, const float *weights, float *out, const size_t stride, const size_t count) {
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 sign = _mm_set1_ps(-0.0f);
+
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4, joints += 16, weights += 16) {
+            __m128 w[4] = {_mm_loadu_ps(weights), _mm_loadu_ps(weights + 4), _mm_loadu_ps(weights + 8), _mm_loadu_ps(weights + 12)};
+            _MM_TRANSPOSE4_PS(w[0], w[1], w[2], w[3]);
+
+            __m128 first[8];
+            load_bones(bones, joints, 0, first);
+
+            __m128 acc[8];
+            for (int k = 0; k < 8; k++) {
+                acc[k] = _mm_mul_ps(w[0], first[k]);
+            }
+            for (int s = 1; s < 4; s++) {
+                __m128 c[8];
+                load_bones(bones, joints, s, c);
+
+                // Negate the weight of bones in the opposite hemisphere to the first bone.
+                const __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(first[0], c[0]), _mm_mul_ps(first[1], c[1])), _mm_add_ps(_mm_mul_ps(first[2], c[2]), _mm_mul_ps(first[3], c[3])));
+                const __m128 ws = _mm_xor_ps(w[s], _mm_and_ps(d, sign));
+                for (int k = 0; k < 8; k++) {
+                    acc[k] = _mm_add_ps(acc[k], _mm_mul_ps(ws, c[k]));
+                }
+            }
+
+            const __m128 length = _mm_add_ps(_mm_add_ps(_mm_mul_ps(acc[0], acc[0]), _mm_mul_ps(acc[1], acc[1])), _mm_add_ps(_mm_mul_ps(acc[2], acc[2]), _mm_mul_ps(acc[3], acc[3])));
+            const __m128 inv = _mm_div_ps(one, _mm_sqrt_ps(length));
+            for (int k = 0; k < 8; k++) {
+                _mm_storeu_ps(out + k * stride + n, _mm_mul_ps(acc[k], inv));
+            }
+        }
+        scalar::dual_quaternion_blend(bones, joints, weights, out + n, stride, count - n);
+    }
+
+    template <bool translate>
+    static void dual_quaternion_transform(const float *dq, const size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, const size_t count) {
+        const __m128 two = _mm_set1_ps(2.0f);
+
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4) {
+            const __m128 rx = _mm_loadu_ps(dq + n);
+            const __m128 ry = _mm_loadu_ps(dq + stride + n);
+            const __m128 rz = _mm_loadu_ps(dq + 2 * stride + n);
+            const __m128 rw = _mm_loadu_ps(dq + 3 * stride + n);
+            const __m128 px = _mm_loadu_ps(x + n);
+            const __m128 py = _mm_loadu_ps(y + n);
+            const __m128 pz = _mm_loadu_ps(z + n);
+
+            const __m128 ux = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(ry, pz), _mm_mul_ps(rz, py)));
+            const __m128 uy = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(rz, px), _mm_mul_ps(rx, pz)));
+            const __m128 uz = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(rx, py), _mm_mul_ps(ry, px)));
+
+            __m128 qx = _mm_add_ps(_mm_add_ps(px, _mm_mul_ps(rw, ux)), _mm_sub_ps(_mm_mul_ps(ry, uz), _mm_mul_ps(rz, uy)));
+            __m128 qy = _mm_add_ps(_mm_add_ps(py, _mm_mul_ps(rw, uy)), _mm_sub_ps(_mm_mul_ps(rz, ux), _mm_mul_ps(rx, uz)));
+            __m128 qz = _mm_add_ps(_mm_add_ps(pz, _mm_mul_ps(rw, uz)), _mm_sub_ps(_mm_mul_ps(rx, uy), _mm_mul_ps(ry, ux)));
+
+            if constexpr (translate) {
+                const __m128 dx = _mm_loadu_ps(dq + 4 * stride + n);
+                const __m128 dy = _mm_loadu_ps(dq + 5 * stride + n);
+                const __m128 dz = _mm_loadu_ps(dq + 6 * stride + n);
+                const __m128 dw = _mm_loadu_ps(dq + 7 * stride + n);
+
+                qx = _mm_add_ps(qx, _mm_mul_ps(two, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(rw, dx), _mm_mul_ps(dw, rx)), _mm_sub_ps(_mm_mul_ps(ry, dz), _mm_mul_ps(rz, dy)))));
+                qy = _mm_add_ps(qy, _mm_mul_ps(two, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(rw, dy), _mm_mul_ps(dw, ry)), _mm_sub_ps(_mm_mul_ps(rz, dx), _mm_mul_ps(rx, dz)))));
+                qz = _mm_add_ps(qz, _mm_mul_ps(two, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(rw, dz), _mm_mul_ps(dw, rz)), _mm_sub_ps(_mm_mul_ps(rx, dy), _mm_mul_ps(ry, dx)))));
+            }
+
+            _mm_storeu_ps(outX + n, qx);
+            _mm_storeu_ps(outY + n, qy);
+            _mm_storeu_ps(outZ + n, qz);
+        }
+        if constexpr (translate) {
+            scalar::dual_quaternion_transform_points(dq + n, stride, x + n, y + n, z + n, outX + n, outY + n, outZ + n, count - n);
+        } else {
+            scalar::dual_quaternion_transform_vectors(dq + n, stride, x + n, y + n, z + n, outX + n, outY + n, outZ + n, count - n);
+        }
+    }
+
+    void dual_quaternion_transform_points(const float *dq, const size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, const size_t count) {
+        dual_quaternion_transform<true>(dq, stride, x, y, z, outX, outY, outZ, count);
+    }
+
+    void dual_quaternion_transform_vectors(const float *dq, const size_t stride, const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, const size_t count) {
+        dual_quaternion_transform<false>(dq, stride, x, y, z, outX, outY, outZ, count);
+    }
+}
@@ -0,0 +1,116 @@
+#include <cstddef>
+#include <immintrin.h>
+
+#include "kernels/kernel_declarations.h"
+#include "kernels/xyz_shuffle.h"
+
+namespace EngineM::kernels::sse {
+    static __m128 dot(const __m128 ax, const __m128 ay, const __m128 az, const __m128 bx, const __m128 by, const __m128 bz) {
+        return _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz));
+    }
+
+    void soa_dot(const float *ax, const float *ay, const float *az, const float *bx, const float *by, const float *bz, float *out, const size_t count) {
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4) {
+            _mm_storeu_ps(out + n, dot(_mm_loadu_ps(ax + n), _mm_loadu_ps(ay + n), _mm_loadu_ps(az + n), _mm_loadu_ps(bx + n), _mm_loadu_ps(by + n), _mm_loadu_ps(bz + n)));
+        }
+        scalar::soa_dot(ax + n, ay + n, az + n, bx + n, by + n, bz + n, out + n, count - n);
+    }
+
+    void soa_cross(const float *ax, const float *ay, const float *az, const float *bx, const float *by, const float *bz, float *outX, float *outY, float *outZ, const size_t count) {
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4) {
+            const __m128 px = _mm_loadu_ps(ax + n);
+            const __m128 py = _mm_loadu_ps(ay + n);
+            const __m128 pz = _mm_loadu_ps(az + n);
+            const __m128 qx = _mm_loadu_ps(bx + n);
+            const __m128 qy = _mm_loadu_ps(by + n);
+            const __m128 qz = _mm_loadu_ps(bz + n);
+
+            const __m128 x = _mm_sub_ps(_mm_mul_ps(py, qz), _mm_mul_ps(pz, qy));
+            const __m128 y = _mm_sub_ps(_mm_mul_ps(pz, qx), _mm_mul_ps(px, qz));
+            const __m128 z = _mm_sub_ps(_mm_mul_ps(px, qy), _mm_mul_ps(py, qx));
+
+            _mm_storeu_ps(outX + n, x);
+            _mm_storeu_ps(outY + n, y);
+            _mm_storeu_ps(outZ + n, z);
+        }
+        scalar::soa_cross(ax + n, ay + n, az + n, bx + n, by + n, bz + n, outX + n, outY + n, outZ + n, count - n);
+    }
+
+    void soa_length(const float *x, const float *y, const float *z, float *out, const size_t count) {
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4) {
+            const __m128 px = _mm_loadu_ps(x + n);
+            const __m128 py = _mm_loadu_ps(y + n);
+            const __m128 pz = _mm_loadu_ps(z + n);
+            _mm_storeu_ps(out + n, _mm_sqrt_ps(dot(px, py, pz, px, py, pz)));
+        }
+        scalar::soa_length(x + n, y + n, z + n, out + n, count - n);
+    }
+
+    void soa_normalise(const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, const size_t count) {
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4) {
+            const __m128 px = _mm_loadu_ps(x + n);
+            const __m128 py = _mm_loadu_ps(y + n);
+            const __m128 pz = _mm_loadu_ps(z + n);
+            const __m128 length = _mm_sqrt_ps(dot(px, py, pz, px, py, pz));
+
+            // Zero-length vectors are left unchanged.
+            const __m128 nonzero = _mm_cmpgt_ps(length, _mm_setzero_ps());
+            const __m128 divisor = _mm_or_ps(_mm_and_ps(nonzero, length), _mm_andnot_ps(nonzero, _mm_set1_ps(1.0f)));
+
+            _mm_storeu_ps(outX + n, _mm_div_ps(px, divisor));
+            _mm_storeu_ps(outY + n, _mm_div_ps(py, divisor));
+            _mm_storeu_ps(outZ + n, _mm_div_ps(pz, divisor));
+        }
+        scalar::soa_normalise(x + n, y + n, z + n, outX + n, outY + n, outZ + n, count - n);
+    }
+
+    void soa_normalise_fast(const float *x, const float *y, const float *z, float *outX, float *outY, float *outZ, const size_t count) {
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4) {
+            const __m128 px = _mm_loadu_ps(x + n);
+            const __m128 py = _mm_loadu_ps(y + n);
+            const __m128 pz = _mm_loadu_ps(z + n);
+            const __m128 squared = dot(px, py, pz, px, py, pz);
+
+            // One Newton-Raphson step on the 12-bit estimate: r = r * (1.5 - 0.5 * s * r * r).
+            const __m128 estimate = _mm_rsqrt_ps(squared);
+            const __m128 refined = _mm_mul_ps(estimate, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), squared), _mm_mul_ps(estimate, estimate))));
+
+            // Zeroing the factor for zero-length vectors leaves them unchanged.
+            const __m128 factor = _mm_and_ps(refined, _mm_cmpgt_ps(squared, _mm_setzero_ps()));
+
+            _mm_storeu_ps(outX + n, _mm_mul_ps(px, factor));
+            _mm_storeu_ps(outY + n, _mm_mul_ps(py, factor));
+            _mm_storeu_ps(outZ + n, _mm_mul_ps(pz, factor));
+        }
+        scalar::soa_normalise(x + n, y + n, z + n, outX + n, outY + n, outZ + n, count - n);
+    }
+
+    void interleave3(const float *x, const float *y, const float *z, float *xyz, const size_t count) {
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4, xyz += 12) {
+            const __m128 px = _mm_loadu_ps(x + n);
+            const __m128 py = _mm_loadu_ps(y + n);
+            const __m128 pz = _mm_loadu_ps(z + n);
+
+            store_xyz(xyz, px, py, pz);
+        }
+        scalar::interleave3(x + n, y + n, z + n, xyz, count - n);
+    }
+
+    void deinterleave3(const float *xyz, float *x, float *y, float *z, const size_t count) {
+        size_t n = 0;
+        for (; n + 4 <= count; n += 4, xyz += 12) {
+            __m128 px, py, pz;
+            load_xyz(xyz, px, py, pz);
+            _mm_storeu_ps(x + n, px);
+            _mm_storeu_ps(y + n, py);
+            _mm_storeu_ps(z + n, pz);
+        }
+        scalar::deinterleave3(xyz, x + n, y + n, z + n, count - n);
+    }
+}
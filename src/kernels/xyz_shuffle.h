@@ -0,0 +1,53 @@
+#pragma once
+
+#include <immintrin.h>
+
+// Conversions between interleaved xyz points and one register per component, shared by the
+// SIMD kernel directories. The helpers are static so each kernel file keeps its own copy,
+// compiled with that directory's instruction set flags.
+namespace EngineM::kernels {
+    // Four points: [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3] to [x0..x3] [y0..y3] [z0..z3].
+    static inline void load_xyz(const float *xyz, __m128 &x, __m128 &y, __m128 &z) {
+        const __m128 a0 = _mm_loadu_ps(xyz);
+        const __m128 a1 = _mm_loadu_ps(xyz + 4);
+        const __m128 a2 = _mm_loadu_ps(xyz + 8);
+
+        x = _mm_shuffle_ps(a0, _mm_shuffle_ps(a1, a2, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm_shuffle_ps(_mm_shuffle_ps(a0, a1, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(a1, a2, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        z = _mm_shuffle_ps(_mm_shuffle_ps(a0, a1, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(a2, a2, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    static inline void store_xyz(float *xyz, const __m128 x, const __m128 y, const __m128 z) {
+        _mm_storeu_ps(xyz, _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(xyz + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(xyz + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+
+#ifdef __AVX__
+    // Eight points. The lanes are regrouped so the low lane holds points 0-3 and the high lane
+    // points 4-7, then both lanes go through the four point shuffles at once.
+    static inline void load_xyz(const float *xyz, __m256 &x, __m256 &y, __m256 &z) {
+        const __m256 l0 = _mm256_loadu_ps(xyz);
+        const __m256 l1 = _mm256_loadu_ps(xyz + 8);
+        const __m256 l2 = _mm256_loadu_ps(xyz + 16);
+
+        const __m256 a0 = _mm256_permute2f128_ps(l0, l1, 0x30);
+        const __m256 a1 = _mm256_permute2f128_ps(l0, l2, 0x21);
+        const __m256 a2 = _mm256_permute2f128_ps(l1, l2, 0x30);
+
+        x = _mm256_shuffle_ps(a0, _mm256_shuffle_ps(a1, a2, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm256_shuffle_ps(_mm256_shuffle_ps(a0, a1, _MM_SHUFFLE(0, 0, 1, 1)), _mm256_shuffle_ps(a1, a2, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        z = _mm256_shuffle_ps(_mm256_shuffle_ps(a0, a1, _MM_SHUFFLE(1, 1, 2, 2)), _mm256_shuffle_ps(a2, a2, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    static inline void store_xyz(float *xyz, const __m256 x, const __m256 y, const __m256 z) {
+        const __m256 b0 = _mm256_shuffle_ps(_mm256_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 b1 = _mm256_shuffle_ps(_mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 b2 = _mm256_shuffle_ps(_mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+
+        _mm256_storeu_ps(xyz, _mm256_permute2f128_ps(b0, b1, 0x20));
+        _mm256_storeu_ps(xyz + 8, _mm256_permute2f128_ps(b2, b0, 0x30));
+        _mm256_storeu_ps(xyz + 16, _mm256_permute2f128_ps(b1, b2, 0x31));
+    }
+#endif
+}
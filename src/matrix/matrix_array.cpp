@@ -0,0 +1,173 @@
+#include "engine-m/matrix/matrix_array.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "engine-m/kernels.h"
+
+namespace EngineM {
+
+    static_assert(sizeof(mat3f) == 9 * sizeof(float), "mat3f must be nine tightly packed floats");
+
+    static const float* floats(const std::span<const mat3f> matrices) {
+        return matrices.empty() ? nullptr : matrices[0][0];
+    }
+
+    static float* floats(const std::span<mat3f> matrices) {
+        return matrices.empty() ? nullptr : matrices[0][0];
+    }
+
+    MatrixArray::MatrixArray(const size_t count): count(count), stride((count + lanes - 1) / lanes * lanes), buffer(9 * stride) {
+
+    }
+
+    MatrixArray::MatrixArray(const std::span<const mat3f> matrices): MatrixArray(matrices.size()) {
+        for (size_t n = 0; n < count; n++) {
+            set(n, matrices[n]);
+        }
+    }
+
+    MatrixArray::MatrixArray(MatrixArray &&array) noexcept: count(std::exchange(array.count, 0)), stride(std::exchange(array.stride, 0)), buffer(std::move(array.buffer)) {
+
+    }
+
+    MatrixArray& MatrixArray::operator=(const MatrixArray &array) {
+        // The buffer goes first: if its allocation throws, nothing has changed.
+        buffer = array.buffer;
+        count = array.count;
+        stride = array.stride;
+        return *this;
+    }
+
+    MatrixArray& MatrixArray::operator=(MatrixArray &&array) noexcept {
+        if (this == &array) {
+            return *this;
+        }
+        count = std::exchange(array.count, 0);
+        stride = std::exchange(array.stride, 0);
+        buffer = std::move(array.buffer);
+        return *this;
+    }
+
+    size_t MatrixArray::size() const {
+        return count;
+    }
+
+    size_t MatrixArray::getStride() const {
+        return stride;
+    }
+
+    float* MatrixArray::stream(const uint32_t i, const uint32_t j) {
+        return buffer.data() + (i * 3 + j) * stride;
+    }
+
+    const float* MatrixArray::stream(const uint32_t i, const uint32_t j) const {
+        return buffer.data() + (i * 3 + j) * stride;
+    }
+
+    mat3f MatrixArray::get(const size_t n) const {
+        mat3f out;
+        for (uint32_t i = 0; i < 3; i++) {
+            for (uint32_t j = 0; j < 3; j++) {
+                out[i][j] = stream(i, j)[n];
+            }
+        }
+        return out;
+    }
+
+    void MatrixArray::set(const size_t n, const mat3f &mat) {
+        for (uint32_t i = 0; i < 3; i++) {
+            for (uint32_t j = 0; j < 3; j++) {
+                stream(i, j)[n] = mat[i][j];
+            }
+        }
+    }
+
+    void MatrixArray::toMatrices(const std::span<mat3f> matrices) const {
+        if (matrices.size() != count) {
+            throw std::invalid_argument("Output span must hold one matrix per array element");
+        }
+        for (size_t n = 0; n < count; n++) {
+            matrices[n] = get(n);
+        }
+    }
+
+    MatrixArray MatrixArray::operator+(const MatrixArray &array) const {
+        MatrixArray out = *this;
+        return out += array;
+    }
+
+    MatrixArray& MatrixArray::operator+=(const MatrixArray &array) {
+        if (count != array.count) {
+            throw std::invalid_argument("Matrix arrays must be the same size");
+        }
+        kernels::get_matrix_kernels().array_add(buffer.data(), array.buffer.data(), buffer.data(), 9 * stride);
+        return *this;
+    }
+
+    MatrixArray MatrixArray::operator-(const MatrixArray &array) const {
+        MatrixArray out = *this;
+        return out -= array;
+    }
+
+    MatrixArray& MatrixArray::operator-=(const MatrixArray &array) {
+        if (count != array.count) {
+            throw std::invalid_argument("Matrix arrays must be the same size");
+        }
+        kernels::get_matrix_kernels().array_sub(buffer.data(), array.buffer.data(), buffer.data(), 9 * stride);
+        return *this;
+    }
+
+    MatrixArray MatrixArray::operator*(const float k) const {
+        MatrixArray out = *this;
+        return out *= k;
+    }
+
+    MatrixArray& MatrixArray::operator*=(const float k) {
+        kernels::get_matrix_kernels().array_mul_by_k(buffer.data(), k, buffer.data(), 9 * stride);
+        return *this;
+    }
+
+    MatrixArray MatrixArray::operator*(const MatrixArray &array) const {
+        MatrixArray out = *this;
+        return out *= array;
+    }
+
+    MatrixArray& MatrixArray::operator*=(const MatrixArray &array) {
+        if (count != array.count) {
+            throw std::invalid_argument("Matrix arrays must be the same size");
+        }
+        kernels::get_matrix_kernels().matrix_mul_soa(buffer.data(), array.buffer.data(), buffer.data(), stride, stride);
+        return *this;
+    }
+
+
+    void addBatch(const std::span<const mat3f> a, const std::span<const mat3f> b, const std::span<mat3f> out) {
+        if (a.size() != b.size() || a.size() != out.size()) {
+            throw std::invalid_argument("Batch spans must be the same size");
+        }
+        kernels::get_matrix_kernels().array_add(floats(a), floats(b), floats(out), 9 * a.size());
+    }
+
+    void subBatch(const std::span<const mat3f> a, const std::span<const mat3f> b, const std::span<mat3f> out) {
+        if (a.size() != b.size() || a.size() != out.size()) {
+            throw std::invalid_argument("Batch spans must be the same size");
+        }
+        kernels::get_matrix_kernels().array_sub(floats(a), floats(b), floats(out), 9 * a.size());
+    }
+
+    void mulBatch(const std::span<const mat3f> a, const float k, const std::span<mat3f> out) {
+        if (a.size() != out.size()) {
+            throw std::invalid_argument("Batch spans must be the same size");
+        }
+        kernels::get_matrix_kernels().array_mul_by_k(floats(a), k, floats(out), 9 * a.size());
+    }
+
+    void mulBatch(const std::span<const mat3f> a, const std::span<const mat3f> b, const std::span<mat3f> out) {
+        if (a.size() != b.size() || a.size() != out.size()) {
+            throw std::invalid_argument("Batch spans must be the same size");
+        }
+        kernels::get_matrix_kernels().matrix_mul_aos(floats(a), floats(b), floats(out), a.size());
+    }
+}
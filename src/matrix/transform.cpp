@@ -0,0 +1,59 @@
+#include "engine-m/matrix/transform.h"
+
+#include <stdexcept>
+
+#include "engine-m/kernels.h"
+
+namespace EngineM {
+
+    static_assert(sizeof(vec3f) == 3 * sizeof(float), "vec3f must be three tightly packed floats");
+
+    template <unsigned int N>
+    static void toAffine(const Matrix<float, N, N> &mat, float (&affine)[3][4]) {
+        for (uint32_t i = 0; i < 3; i++) {
+            for (uint32_t j = 0; j < 4; j++) {
+                affine[i][j] = j < N ? mat[i][j] : 0.0f;
+            }
+        }
+    }
+
+    template <unsigned int N>
+    static void transformAoS(const Matrix<float, N, N> &mat, const std::span<const vec3f> in, const std::span<vec3f> out) {
+        if (in.size() != out.size()) {
+            throw std::invalid_argument("Input and output spans must be the same size");
+        }
+        if (in.empty()) {
+            return;
+        }
+        float affine[3][4];
+        toAffine(mat, affine);
+        kernels::get_matrix_kernels().transform_aos(affine, in[0].data, out[0].data, in.size());
+    }
+
+    template <unsigned int N>
+    static void transformSoA(const Matrix<float, N, N> &mat, const std::span<const float> x, const std::span<const float> y, const std::span<const float> z, const std::span<float> outX, const std::span<float> outY, const std::span<float> outZ) {
+        const size_t count = x.size();
+        if (y.size() != count || z.size() != count || outX.size() != count || outY.size() != count || outZ.size() != count) {
+            throw std::invalid_argument("Coordinate streams must be the same size");
+        }
+        float affine[3][4];
+        toAffine(mat, affine);
+        kernels::get_matrix_kernels().transform_soa(affine, x.data(), y.data(), z.data(), outX.data(), outY.data(), outZ.data(), count);
+    }
+
+    void transformPoints(const mat3f &mat, const std::span<const vec3f> in, const std::span<vec3f> out) {
+        transformAoS(mat, in, out);
+    }
+
+    void transformPoints(const mat4f &mat, const std::span<const vec3f> in, const std::span<vec3f> out) {
+        transformAoS(mat, in, out);
+    }
+
+    void transformPoints(const mat3f &mat, const std::span<const float> x, const std::span<const float> y, const std::span<const float> z, const std::span<float> outX, const std::span<float> outY, const std::span<float> outZ) {
+        transformSoA(mat, x, y, z, outX, outY, outZ);
+    }
+
+    void transformPoints(const mat4f &mat, const std::span<const float> x, const std::span<const float> y, const std::span<const float> z, const std::span<float> outX, const std::span<float> outY, const std::span<float> outZ) {
+        transformSoA(mat, x, y, z, outX, outY, outZ);
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace EngineM {
+
+    // Number of threads worth using for count items when each should get at least minPerThread.
+    inline size_t parallelThreadCount(const size_t count, const size_t minPerThread) {
+        const size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+        return std::min(hardware, count / minPerThread);
+    }
+
+    // Splits [0, count) into at most `threads` contiguous ranges whose length is a multiple of
+    // granularity and calls body(index, begin, end) for each, the first on the calling thread.
+    // Returns the number of ranges. Workers are jthreads, so they are joined on every exit,
+    // including when starting a later one throws.
+    template <typename F>
+    size_t parallelForRanges(const size_t count, const size_t threads, const size_t granularity, const F &body) {
+        if (threads <= 1) {
+            body(size_t(0), size_t(0), count);
+            return 1;
+        }
+
+        const size_t chunk = ((count + threads - 1) / threads + granularity - 1) / granularity * granularity;
+        std::vector<std::jthread> workers;
+        workers.reserve(threads - 1);
+        size_t ranges = 1;
+        for (size_t begin = chunk; begin < count; begin += chunk, ranges++) {
+            workers.emplace_back([&body, ranges, begin, end = std::min(begin + chunk, count)] {
+                body(ranges, begin, end);
+            });
+        }
+        body(size_t(0), size_t(0), std::min(chunk, count));
+        return ranges;
+    }
+}
@@ -0,0 +1,13 @@
+#include "engine-m/quaternion/dual_quaternion.h"
+
+namespace EngineM {
+
+    void DualQuaternion::normalise() {
+        const float n = real.norm();
+        if (n == 0) {
+            return ;
+        }
+        real /= n;
+        dual /= n;
+    }
+}
@@ -0,0 +1,65 @@
+#include "engine-m/quaternion/interpolation.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include "engine-m/kernels.h"
+
+namespace EngineM {
+
+    static void checkSize(const size_t a, const size_t b, const size_t t, const size_t out) {
+        if (a != b || a != t || a != out) {
+            throw std::invalid_argument("Quaternion, parameter and output spans must be the same size");
+        }
+    }
+
+    Quaternion nlerp(const Quaternion &a, const Quaternion &b, const float t) {
+        Quaternion out;
+        kernels::get_quaternion_kernels(SIMD::Level::Scalar).quaternion_nlerp(a.data(), b.data(), &t, out.data(), 1);
+        return out;
+    }
+
+    Quaternion slerp(const Quaternion &a, const Quaternion &b, const float t) {
+        float d = a.a * b.a + a.v * b.v;
+        const float sign = d < 0 ? -1.0f : 1.0f;
+        d *= sign;
+
+        // Below about two degrees sin θ loses precision and nlerp is indistinguishable.
+        if (d > 0.9995f) {
+            return nlerp(a, b, t);
+        }
+
+        const float theta = std::acos(d);
+        const float inv = 1 / std::sin(theta);
+        return a * (std::sin((1 - t) * theta) * inv) + b * (sign * std::sin(t * theta) * inv);
+    }
+
+    Quaternion slerpFast(const Quaternion &a, const Quaternion &b, const float t) {
+        Quaternion out;
+        kernels::get_quaternion_kernels(SIMD::Level::Scalar).quaternion_slerp_fast(a.data(), b.data(), &t, out.data(), 1);
+        return out;
+    }
+
+    void nlerp(const std::span<const Quaternion> a, const std::span<const Quaternion> b, const std::span<const float> t, const std::span<Quaternion> out) {
+        checkSize(a.size(), b.size(), t.size(), out.size());
+        if (a.empty()) {
+            return;
+        }
+        kernels::get_quaternion_kernels().quaternion_nlerp(a[0].data(), b[0].data(), t.data(), out[0].data(), a.size());
+    }
+
+    void slerp(const std::span<const Quaternion> a, const std::span<const Quaternion> b, const std::span<const float> t, const std::span<Quaternion> out) {
+        checkSize(a.size(), b.size(), t.size(), out.size());
+        for (size_t n = 0; n < a.size(); n++) {
+            out[n] = slerp(a[n], b[n], t[n]);
+        }
+    }
+
+    void slerpFast(const std::span<const Quaternion> a, const std::span<const Quaternion> b, const std::span<const float> t, const std::span<Quaternion> out) {
+        checkSize(a.size(), b.size(), t.size(), out.size());
+        if (a.empty()) {
+            return;
+        }
+        kernels::get_quaternion_kernels().quaternion_slerp_fast(a[0].data(), b[0].data(), t.data(), out[0].data(), a.size());
+    }
+}
@@ -0,0 +1,110 @@
+#include "engine-m/quaternion/rotation.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include "engine-m/kernels.h"
+
+namespace EngineM {
+
+    static_assert(sizeof(Quaternion) == 4 * sizeof(float), "Quaternion must be four tightly packed floats");
+    static_assert(sizeof(mat3x4f) == 12 * sizeof(float), "mat3x4f must be twelve tightly packed floats");
+
+    mat3f toMatrix(const Quaternion &q) {
+        mat3f out;
+        kernels::get_quaternion_kernels(SIMD::Level::Scalar).quaternion_to_matrix3(q.data(), out[0], 1);
+        return out;
+    }
+
+    mat4f toMatrix4(const Quaternion &q) {
+        mat4f out;
+        kernels::get_quaternion_kernels(SIMD::Level::Scalar).quaternion_to_matrix34(q.data(), out[0], 1);
+        out[3][0] = out[3][1] = out[3][2] = 0;
+        out[3][3] = 1;
+        return out;
+    }
+
+    template <unsigned int N>
+    static Quaternion shepperd(const Matrix<float, N, N> &m) {
+        const float trace = m[0][0] + m[1][1] + m[2][2];
+
+        Quaternion q;
+        if (trace >= m[0][0] && trace >= m[1][1] && trace >= m[2][2]) {
+            q.a = 0.5f * std::sqrt(1 + trace);
+            const float s = 0.25f / q.a;
+            q.v = vec3f(m[2][1] - m[1][2], m[0][2] - m[2][0], m[1][0] - m[0][1]) * s;
+        } else if (m[0][0] >= m[1][1] && m[0][0] >= m[2][2]) {
+            q.v.x = 0.5f * std::sqrt(1 + m[0][0] - m[1][1] - m[2][2]);
+            const float s = 0.25f / q.v.x;
+            q.a = (m[2][1] - m[1][2]) * s;
+            q.v.y = (m[0][1] + m[1][0]) * s;
+            q.v.z = (m[0][2] + m[2][0]) * s;
+        } else if (m[1][1] >= m[2][2]) {
+            q.v.y = 0.5f * std::sqrt(1 - m[0][0] + m[1][1] - m[2][2]);
+            const float s = 0.25f / q.v.y;
+            q.a = (m[0][2] - m[2][0]) * s;
+            q.v.x = (m[0][1] + m[1][0]) * s;
+            q.v.z = (m[1][2] + m[2][1]) * s;
+        } else {
+            q.v.z = 0.5f * std::sqrt(1 - m[0][0] - m[1][1] + m[2][2]);
+            const float s = 0.25f / q.v.z;
+            q.a = (m[1][0] - m[0][1]) * s;
+            q.v.x = (m[0][2] + m[2][0]) * s;
+            q.v.y = (m[1][2] + m[2][1]) * s;
+        }
+        return q;
+    }
+
+    Quaternion fromMatrix(const mat3f &mat) {
+        return shepperd(mat);
+    }
+
+    Quaternion fromMatrix(const mat4f &mat) {
+        return shepperd(mat);
+    }
+
+    void toMatrices(const std::span<const Quaternion> q, const std::span<mat3f> out) {
+        if (q.size() != out.size()) {
+            throw std::invalid_argument("Quaternion and matrix spans must be the same size");
+        }
+        if (q.empty()) {
+            return;
+        }
+        kernels::get_quaternion_kernels().quaternion_to_matrix3(q[0].data(), out[0][0], q.size());
+    }
+
+    void toMatrices(const std::span<const Quaternion> q, const std::span<mat3x4f> out) {
+        if (q.size() != out.size()) {
+            throw std::invalid_argument("Quaternion and matrix spans must be the same size");
+        }
+        if (q.empty()) {
+            return;
+        }
+        kernels::get_quaternion_kernels().quaternion_to_matrix34(q[0].data(), out[0][0], q.size());
+    }
+
+    void rotatePoints(const Quaternion &q, const std::span<const vec3f> in, const std::span<vec3f> out) {
+        if (in.size() != out.size()) {
+            throw std::invalid_argument("Input and output spans must be the same size");
+        }
+        if (in.empty()) {
+            return;
+        }
+
+        // With one quaternion for every point, its rotation matrix is cheaper per point
+        // (9 multiplies) than the cross-product form, so reuse the transform kernel.
+        float affine[3][4];
+        kernels::get_quaternion_kernels(SIMD::Level::Scalar).quaternion_to_matrix34(q.data(), affine[0], 1);
+        kernels::get_matrix_kernels().transform_aos(affine, in[0].data, out[0].data, in.size());
+    }
+
+    void rotatePoints(const std::span<const Quaternion> q, const std::span<const vec3f> in, const std::span<vec3f> out) {
+        if (q.size() != in.size() || in.size() != out.size()) {
+            throw std::invalid_argument("Quaternion, input and output spans must be the same size");
+        }
+        if (in.empty()) {
+            return;
+        }
+        kernels::get_quaternion_kernels().quaternion_rotate(q[0].data(), in[0].data, out[0].data, in.size());
+    }
+}
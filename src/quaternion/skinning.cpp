@@ -0,0 +1,73 @@
+#include "engine-m/quaternion/skinning.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "engine-m/kernels.h"
+#include "parallel.h"
+
+namespace EngineM {
+
+    static_assert(sizeof(DualQuaternion) == 8 * sizeof(float), "DualQuaternion must be eight tightly packed floats");
+    static_assert(sizeof(vec4) == 4 * sizeof(int32_t) && sizeof(vec4f) == 4 * sizeof(float), "Influences must be four tightly packed values");
+
+    // Vertices blended per kernel call; the eight dual quaternion streams live on the stack.
+    static constexpr size_t block = 256;
+
+    // Smallest share of vertices worth handing to a separate thread.
+    static constexpr size_t verticesPerThread = 1 << 14;
+
+    static void checkInfluences(const std::span<const DualQuaternion> bones, const std::span<const vec4> joints, const std::span<const vec4f> weights, const size_t count) {
+        if (joints.size() != count || weights.size() != count) {
+            throw std::invalid_argument("Joints, weights and vertices must be the same size");
+        }
+        for (const vec4 &j : joints) {
+            for (int s = 0; s < 4; s++) {
+                if (j[s] < 0 || static_cast<size_t>(j[s]) >= bones.size()) {
+                    throw std::invalid_argument("Joint index out of range");
+                }
+            }
+        }
+    }
+
+    static void skin(const std::span<const DualQuaternion> bones, const std::span<const vec4> joints, const std::span<const vec4f> weights, const Vec3Array &positions, const Vec3Array *normals, Vec3Array &outPositions, Vec3Array *outNormals) {
+        const size_t count = positions.size();
+        checkInfluences(bones, joints, weights, count);
+        if (outPositions.size() != count || (normals != nullptr && (normals->size() != count || outNormals->size() != count))) {
+            throw std::invalid_argument("Vertex arrays must be the same size");
+        }
+        if (count == 0) {
+            return;
+        }
+
+        const kernels::QuaternionKernels &quaternion = kernels::get_quaternion_kernels();
+        const float *b = bones[0].real.data();
+        const int32_t *j = joints[0].data;
+        const float *w = weights[0].data;
+
+        // Ranges are block aligned so each thread blends whole blocks.
+        parallelForRanges(count, parallelThreadCount(count, verticesPerThread), block, [&](size_t, const size_t begin, const size_t end) {
+            alignas(32) float dq[8 * block];
+            for (size_t i = begin; i < end; i += block) {
+                const size_t n = std::min(block, end - i);
+                quaternion.dual_quaternion_blend(b, j + 4 * i, w + 4 * i, dq, block, n);
+                quaternion.dual_quaternion_transform_points(dq, block,
+                    positions.x().data() + i, positions.y().data() + i, positions.z().data() + i,
+                    outPositions.x().data() + i, outPositions.y().data() + i, outPositions.z().data() + i, n);
+                if (normals != nullptr) {
+                    quaternion.dual_quaternion_transform_vectors(dq, block,
+                        normals->x().data() + i, normals->y().data() + i, normals->z().data() + i,
+                        outNormals->x().data() + i, outNormals->y().data() + i, outNormals->z().data() + i, n);
+                }
+            }
+        });
+    }
+
+    void skin(const std::span<const DualQuaternion> bones, const std::span<const vec4> joints, const std::span<const vec4f> weights, const Vec3Array &positions, Vec3Array &outPositions) {
+        skin(bones, joints, weights, positions, nullptr, outPositions, nullptr);
+    }
+
+    void skin(const std::span<const DualQuaternion> bones, const std::span<const vec4> joints, const std::span<const vec4f> weights, const Vec3Array &positions, const Vec3Array &normals, Vec3Array &outPositions, Vec3Array &outNormals) {
+        skin(bones, joints, weights, positions, &normals, outPositions, &outNormals);
+    }
+}
@@ -1,5 +1,10 @@
 #include "engine-m/simd.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
 #if defined(_MSC_VER)
 #include <intrin.h>
 #elif defined(__GNUC__) || defined(__clang__)
@@ -11,9 +16,9 @@ namespace EngineM::SIMD {
 #if defined(__GNUC__) || defined(__clang__)
     __attribute__((target("xsave")))
 #endif
-    Level get_simd_level() {
+    static uint32_t detect_features() {
 #if !defined(__i386__) && !defined(__x86_64__) && !defined(_M_IX86) && !defined(_M_X64)
-        return Level::Scalar;
+        return 0;
 #else
         int cpu_info[4];
 
@@ -25,17 +30,23 @@ namespace EngineM::SIMD {
 #endif
         };
 
+        auto set = [](uint32_t &features, const Feature feature, const bool present) {
+            if (present) {
+                features |= static_cast<uint32_t>(feature);
+            }
+        };
+
         call_cpuid(0, 0, cpu_info);
 
         int nIds = cpu_info[0];
         if (nIds < 1) {
-            return Level::Scalar;
+            return 0;
         }
 
+        uint32_t features = 0;
+
         call_cpuid(1, 0, cpu_info);
-        bool has_sse2 = (cpu_info[3] & (1 << 26)) != 0;
         bool has_osxsave = (cpu_info[2] & (1 << 27)) != 0;
-        bool has_avx = (cpu_info[2] & (1 << 28)) != 0;
 
         bool os_avx_support = false;
         bool os_avx512_support = false;
@@ -52,27 +63,95 @@ namespace EngineM::SIMD {
             os_avx512_support = os_avx_support && ((xcr0 & 0xE0) == 0xE0);
         }
 
-        if (nIds >= 7 && os_avx_support) {
+        set(features, Feature::SSE2, (cpu_info[3] & (1 << 26)) != 0);
+        set(features, Feature::SSE3, (cpu_info[2] & (1 << 0)) != 0);
+        set(features, Feature::SSSE3, (cpu_info[2] & (1 << 9)) != 0);
+        set(features, Feature::SSE41, (cpu_info[2] & (1 << 19)) != 0);
+        set(features, Feature::SSE42, (cpu_info[2] & (1 << 20)) != 0);
+        set(features, Feature::POPCNT, (cpu_info[2] & (1 << 23)) != 0);
+
+        // VEX-encoded extensions are only usable when the OS saves the YMM state.
+        set(features, Feature::AVX, os_avx_support && (cpu_info[2] & (1 << 28)) != 0);
+        set(features, Feature::FMA, os_avx_support && (cpu_info[2] & (1 << 12)) != 0);
+        set(features, Feature::F16C, os_avx_support && (cpu_info[2] & (1 << 29)) != 0);
+
+        if (nIds >= 7) {
             call_cpuid(7, 0, cpu_info);
-            bool has_avx2 = (cpu_info[1] & (1 << 5)) != 0;
-            bool has_avx512f = (cpu_info[1] & (1 << 16)) != 0;
-
-            // TODO: for future support
-            // if (has_avx512f && os_avx512_support) {
-            //     return Level::AVX512;
-            // }
-            if (has_avx2) {
-                return Level::AVX2;
-            }
-            if (has_avx) {
-                return Level::AVX;
-            }
+            set(features, Feature::AVX2, os_avx_support && (cpu_info[1] & (1 << 5)) != 0);
+            set(features, Feature::BMI1, (cpu_info[1] & (1 << 3)) != 0);
+            set(features, Feature::BMI2, (cpu_info[1] & (1 << 8)) != 0);
+            set(features, Feature::AVX512F, os_avx512_support && (cpu_info[1] & (1 << 16)) != 0);
         }
 
-        if (has_sse2) {
+        return features;
+#endif
+    }
+
+    uint32_t get_features() {
+        static const uint32_t features = detect_features();
+        return features;
+    }
+
+    bool has_feature(const Feature feature) {
+        return (get_features() & static_cast<uint32_t>(feature)) != 0;
+    }
+
+    Level get_simd_level() {
+        // TODO: for future support
+        // if (has_feature(Feature::AVX512F)) {
+        //     return Level::AVX512;
+        // }
+        // The AVX2 tiers also use F16C, which every AVX2 processor implements.
+        if (has_feature(Feature::AVX2) && has_feature(Feature::F16C) && has_feature(Feature::FMA)) {
+            return Level::AVX2_FMA;
+        }
+        if (has_feature(Feature::AVX2) && has_feature(Feature::F16C)) {
+            return Level::AVX2;
+        }
+        if (has_feature(Feature::AVX)) {
+            return Level::AVX;
+        }
+        if (has_feature(Feature::SSE2)) {
             return Level::SSE2;
         }
         return Level::Scalar;
-#endif
     }
-}
\ No newline at end of file
+
+    static Level level_from_env(const Level fallback) {
+        const char *value = std::getenv("ENGINEM_SIMD_LEVEL");
+        if (value == nullptr) {
+            return fallback;
+        }
+        if (std::strcmp(value, "scalar") == 0) {
+            return Level::Scalar;
+        }
+        if (std::strcmp(value, "sse2") == 0) {
+            return Level::SSE2;
+        }
+        if (std::strcmp(value, "avx") == 0) {
+            return Level::AVX;
+        }
+        if (std::strcmp(value, "avx2") == 0) {
+            return Level::AVX2;
+        }
+        if (std::strcmp(value, "avx2_fma") == 0) {
+            return Level::AVX2_FMA;
+        }
+        return fallback;
+    }
+
+    static std::atomic<Level>& active_level() {
+        static std::atomic<Level> level(std::min(level_from_env(get_simd_level()), get_simd_level()));
+        return level;
+    }
+
+    Level get_active_level() {
+        return active_level().load(std::memory_order_relaxed);
+    }
+
+    Level set_active_level(const Level level) {
+        const Level clamped = std::min(level, get_simd_level());
+        active_level().store(clamped, std::memory_order_relaxed);
+        return clamped;
+    }
+}
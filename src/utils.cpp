@@ -1,15 +1,15 @@
 #include "engine-m/utils.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <stdexcept>
 
 #include "engine-m/constants.h"
+#include "engine-m/kernels.h"
 
 namespace EngineM {
 
-    bool equals(const float a, const float b) {
-        return std::fabs(a - b) < epsilon;
-    }
-
     int clamp(const int value, const int min, const int max) {
         return std::max(min, std::min(value, max));
     }
@@ -38,6 +38,29 @@ namespace EngineM {
         return p1 * (1 - t) + p2 * t;
     }
 
+    void lerp(const std::span<const vec3f> p1, const std::span<const vec3f> p2, const float t, const std::span<vec3f> out) {
+        if (p1.size() != p2.size() || p1.size() != out.size()) {
+            throw std::invalid_argument("Lerp spans must be the same size");
+        }
+        if (p1.empty()) {
+            return;
+        }
+        kernels::get_curve_kernels().lerp(p1[0].data, p2[0].data, t, out[0].data, 3 * p1.size());
+    }
+
+    void evaluatePolynomial(const std::span<const vec3f> coefficients, const std::span<const float> t, const std::span<vec3f> out) {
+        if (coefficients.empty()) {
+            throw std::invalid_argument("Polynomial must have at least one coefficient");
+        }
+        if (t.size() != out.size()) {
+            throw std::invalid_argument("Parameter and output spans must be the same size");
+        }
+        if (t.empty()) {
+            return;
+        }
+        kernels::get_curve_kernels().polynomial(coefficients[0].data, coefficients.size() - 1, t.data(), out[0].data, t.size());
+    }
+
     uint64_t factorial(const uint64_t n) {
         uint64_t fact = 1;
         for (uint64_t i = 1; i <= n; i++) {
@@ -46,7 +69,38 @@ namespace EngineM {
         return fact;
     }
 
-    float binomialCoefficient(const int n, const int k) {
-        return static_cast<float>(factorial(n)) / static_cast<float>(factorial(k) * factorial(n - k));
+    // Rows 0 to 64 of Pascal's triangle, built with additions only so every entry is exact
+    // (C(64, 32) still fits in 64 bits, unlike 21!).
+    static constexpr int pascalRows = 65;
+
+    static constexpr auto pascal = [] {
+        std::array<uint64_t, pascalRows * (pascalRows + 1) / 2> triangle {};
+        for (int n = 0, row = 0; n < pascalRows; row += n + 1, n++) {
+            triangle[row] = triangle[row + n] = 1;
+            for (int k = 1; k < n; k++) {
+                triangle[row + k] = triangle[row - n + k - 1] + triangle[row - n + k];
+            }
+        }
+        return triangle;
+    }();
+
+    static_assert(pascal[64 * 65 / 2 + 32] == 1832624140942590534ull);
+
+    float binomialCoefficient(const int n, int k) {
+        if (k < 0 || k > n) {
+            return 0;
+        }
+        if (n < pascalRows) {
+            return static_cast<float>(pascal[n * (n + 1) / 2 + k]);
+        }
+
+        // Multiplicative form: each partial product is itself a binomial coefficient, so
+        // nothing overflows before the result does.
+        k = std::min(k, n - k);
+        double c = 1;
+        for (int i = 1; i <= k; i++) {
+            c = c * (n - k + i) / i;
+        }
+        return static_cast<float>(c);
     }
 }
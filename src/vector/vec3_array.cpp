@@ -0,0 +1,182 @@
+#include "engine-m/vector/vec3_array.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "engine-m/kernels.h"
+#include "engine-m/vector/vector_buffer.h"
+
+namespace EngineM {
+
+    Vec3Array::Vec3Array(const size_t count): count(count), stride((count + lanes - 1) / lanes * lanes), buffer(3 * stride) {
+
+    }
+
+    Vec3Array::Vec3Array(const std::span<const vec3f> points): Vec3Array(points.size()) {
+        kernels::get_vector_kernels().deinterleave3(asFloats(points).data(), buffer.data(), buffer.data() + stride, buffer.data() + 2 * stride, count);
+    }
+
+    Vec3Array::Vec3Array(Vec3Array &&array) noexcept: count(std::exchange(array.count, 0)), stride(std::exchange(array.stride, 0)), buffer(std::move(array.buffer)) {
+
+    }
+
+    Vec3Array& Vec3Array::operator=(const Vec3Array &array) {
+        // The buffer goes first: if its allocation throws, nothing has changed.
+        buffer = array.buffer;
+        count = array.count;
+        stride = array.stride;
+        return *this;
+    }
+
+    Vec3Array& Vec3Array::operator=(Vec3Array &&array) noexcept {
+        if (this == &array) {
+            return *this;
+        }
+        count = std::exchange(array.count, 0);
+        stride = std::exchange(array.stride, 0);
+        buffer = std::move(array.buffer);
+        return *this;
+    }
+
+    size_t Vec3Array::size() const {
+        return count;
+    }
+
+    size_t Vec3Array::getStride() const {
+        return stride;
+    }
+
+    std::span<float> Vec3Array::stream(const uint32_t i) {
+        return {buffer.data() + i * stride, count};
+    }
+
+    std::span<const float> Vec3Array::stream(const uint32_t i) const {
+        return {buffer.data() + i * stride, count};
+    }
+
+    std::span<float> Vec3Array::x() {
+        return stream(0);
+    }
+
+    std::span<float> Vec3Array::y() {
+        return stream(1);
+    }
+
+    std::span<float> Vec3Array::z() {
+        return stream(2);
+    }
+
+    std::span<const float> Vec3Array::x() const {
+        return stream(0);
+    }
+
+    std::span<const float> Vec3Array::y() const {
+        return stream(1);
+    }
+
+    std::span<const float> Vec3Array::z() const {
+        return stream(2);
+    }
+
+    vec3f Vec3Array::get(const size_t n) const {
+        const float *data = buffer.data();
+        return {data[n], data[stride + n], data[2 * stride + n]};
+    }
+
+    void Vec3Array::set(const size_t n, const vec3f &vec) {
+        float *data = buffer.data();
+        data[n] = vec.x;
+        data[stride + n] = vec.y;
+        data[2 * stride + n] = vec.z;
+    }
+
+    void Vec3Array::toPoints(const std::span<vec3f> points) const {
+        if (points.size() != count) {
+            throw std::invalid_argument("Output span must hold one point per array element");
+        }
+        kernels::get_vector_kernels().interleave3(buffer.data(), buffer.data() + stride, buffer.data() + 2 * stride, asFloats(points).data(), count);
+    }
+
+    Vec3Array Vec3Array::operator+(const Vec3Array &array) const {
+        Vec3Array out = *this;
+        return out += array;
+    }
+
+    Vec3Array& Vec3Array::operator+=(const Vec3Array &array) {
+        if (count != array.count) {
+            throw std::invalid_argument("Vector arrays must be the same size");
+        }
+        kernels::get_matrix_kernels().array_add(buffer.data(), array.buffer.data(), buffer.data(), 3 * stride);
+        return *this;
+    }
+
+    Vec3Array Vec3Array::operator-(const Vec3Array &array) const {
+        Vec3Array out = *this;
+        return out -= array;
+    }
+
+    Vec3Array& Vec3Array::operator-=(const Vec3Array &array) {
+        if (count != array.count) {
+            throw std::invalid_argument("Vector arrays must be the same size");
+        }
+        kernels::get_matrix_kernels().array_sub(buffer.data(), array.buffer.data(), buffer.data(), 3 * stride);
+        return *this;
+    }
+
+    Vec3Array Vec3Array::operator*(const float k) const {
+        Vec3Array out = *this;
+        return out *= k;
+    }
+
+    Vec3Array& Vec3Array::operator*=(const float k) {
+        kernels::get_matrix_kernels().array_mul_by_k(buffer.data(), k, buffer.data(), 3 * stride);
+        return *this;
+    }
+
+    void Vec3Array::dot(const Vec3Array &array, const std::span<float> out) const {
+        if (count != array.count) {
+            throw std::invalid_argument("Vector arrays must be the same size");
+        }
+        if (out.size() != count) {
+            throw std::invalid_argument("Output span must hold one value per array element");
+        }
+        kernels::get_vector_kernels().soa_dot(buffer.data(), buffer.data() + stride, buffer.data() + 2 * stride, array.buffer.data(), array.buffer.data() + stride, array.buffer.data() + 2 * stride, out.data(), count);
+    }
+
+    void Vec3Array::length(const std::span<float> out) const {
+        if (out.size() != count) {
+            throw std::invalid_argument("Output span must hold one value per array element");
+        }
+        kernels::get_vector_kernels().soa_length(buffer.data(), buffer.data() + stride, buffer.data() + 2 * stride, out.data(), count);
+    }
+
+    Vec3Array Vec3Array::cross(const Vec3Array &array) const {
+        if (count != array.count) {
+            throw std::invalid_argument("Vector arrays must be the same size");
+        }
+        Vec3Array out(count);
+        kernels::get_vector_kernels().soa_cross(buffer.data(), buffer.data() + stride, buffer.data() + 2 * stride, array.buffer.data(), array.buffer.data() + stride, array.buffer.data() + 2 * stride, out.buffer.data(), out.buffer.data() + stride, out.buffer.data() + 2 * stride, stride);
+        return out;
+    }
+
+    Vec3Array& Vec3Array::normalise() {
+        kernels::get_vector_kernels().soa_normalise(buffer.data(), buffer.data() + stride, buffer.data() + 2 * stride, buffer.data(), buffer.data() + stride, buffer.data() + 2 * stride, stride);
+        return *this;
+    }
+
+    Vec3Array& Vec3Array::normaliseFast() {
+        kernels::get_vector_kernels().soa_normalise_fast(buffer.data(), buffer.data() + stride, buffer.data() + 2 * stride, buffer.data(), buffer.data() + stride, buffer.data() + 2 * stride, stride);
+        return *this;
+    }
+
+    Vec3Array Vec3Array::lerp(const Vec3Array &a, const Vec3Array &b, const float t) {
+        if (a.count != b.count) {
+            throw std::invalid_argument("Vector arrays must be the same size");
+        }
+        Vec3Array out(a.count);
+        kernels::get_curve_kernels().lerp(a.buffer.data(), b.buffer.data(), t, out.buffer.data(), 3 * a.stride);
+        return out;
+    }
+
+}
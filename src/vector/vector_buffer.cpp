@@ -0,0 +1,109 @@
+#include "engine-m/vector/vector_buffer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "engine-m/kernels.h"
+
+namespace EngineM {
+
+    static void checkStride(const size_t count, const size_t floats, const size_t stride) {
+        if (stride < 3) {
+            throw std::invalid_argument("Stride must be at least three floats");
+        }
+        if (count != 0 && floats < (count - 1) * stride + 3) {
+            throw std::invalid_argument("Buffer is too small for the number of points");
+        }
+    }
+
+    std::span<const float> asFloats(const std::span<const vec3f> points) {
+        return points.empty() ? std::span<const float>() : std::span<const float>(points[0].data, 3 * points.size());
+    }
+
+    std::span<float> asFloats(const std::span<vec3f> points) {
+        return points.empty() ? std::span<float>() : std::span<float>(points[0].data, 3 * points.size());
+    }
+
+    void copyPoints(const std::span<const vec3f> in, const std::span<vec3f> out) {
+        if (in.size() != out.size()) {
+            throw std::invalid_argument("Input and output spans must be the same size");
+        }
+        if (!in.empty()) {
+            std::memmove(out.data(), in.data(), in.size_bytes());
+        }
+    }
+
+    template <typename From, typename To>
+    static void convert(const std::span<const Vector<From, 3>> in, const std::span<Vector<To, 3>> out) {
+        if (in.size() != out.size()) {
+            throw std::invalid_argument("Input and output spans must be the same size");
+        }
+        if (in.empty()) {
+            return;
+        }
+        const From *src = in[0].data;
+        To *dst = out[0].data;
+        for (size_t i = 0; i < 3 * in.size(); i++) {
+            dst[i] = static_cast<To>(src[i]);
+        }
+    }
+
+    void convertPoints(const std::span<const vec3f> in, const std::span<vec3d> out) {
+        convert(in, out);
+    }
+
+    void convertPoints(const std::span<const vec3d> in, const std::span<vec3f> out) {
+        convert(in, out);
+    }
+
+    void packPoints(const std::span<const vec3f> in, const std::span<float> out, const size_t stride) {
+        checkStride(in.size(), out.size(), stride);
+        if (stride == 3) {
+            if (!in.empty()) {
+                std::memmove(out.data(), in.data(), in.size_bytes());
+            }
+            return;
+        }
+        for (size_t i = 0; i < in.size(); i++) {
+            std::memcpy(out.data() + i * stride, in[i].data, sizeof(vec3f));
+        }
+    }
+
+    void unpackPoints(const std::span<const float> in, const size_t stride, const std::span<vec3f> out) {
+        checkStride(out.size(), in.size(), stride);
+        for (size_t i = 0; i < out.size(); i++) {
+            std::memcpy(out[i].data, in.data() + i * stride, sizeof(vec3f));
+        }
+    }
+
+    using NormaliseKernel = void (*)(const float *, const float *, const float *, float *, float *, float *, size_t);
+
+    // Deinterleaves a block of points onto the stack, normalises the streams and
+    // interleaves them back, so each block is fully read before it is written.
+    static void normalise(const std::span<const vec3f> in, const std::span<vec3f> out, const NormaliseKernel kernel) {
+        if (in.size() != out.size()) {
+            throw std::invalid_argument("Input and output spans must be the same size");
+        }
+        constexpr size_t block = 256;
+        alignas(32) float x[block];
+        alignas(32) float y[block];
+        alignas(32) float z[block];
+
+        const kernels::VectorKernels &vector = kernels::get_vector_kernels();
+        for (size_t i = 0; i < in.size(); i += block) {
+            const size_t count = std::min(block, in.size() - i);
+            vector.deinterleave3(in[i].data, x, y, z, count);
+            kernel(x, y, z, x, y, z, count);
+            vector.interleave3(x, y, z, out[i].data, count);
+        }
+    }
+
+    void normalisePoints(const std::span<const vec3f> in, const std::span<vec3f> out) {
+        normalise(in, out, kernels::get_vector_kernels().soa_normalise);
+    }
+
+    void normalisePointsFast(const std::span<const vec3f> in, const std::span<vec3f> out) {
+        normalise(in, out, kernels::get_vector_kernels().soa_normalise_fast);
+    }
+}
@@ -0,0 +1,61 @@
+#include "engine-m/vector/vector_compression.h"
+
+#include <stdexcept>
+
+#include "engine-m/kernels.h"
+
+namespace EngineM {
+
+    static void checkSize(const size_t in, const size_t out) {
+        if (in != out) {
+            throw std::invalid_argument("Input and output spans must be the same size");
+        }
+    }
+
+    template <typename V>
+    static auto components(const std::span<V> v) {
+        return v.empty() ? nullptr : &v[0][0];
+    }
+
+    uint16_t floatToHalf(const float f) {
+        uint16_t out;
+        kernels::get_vector_kernels(SIMD::Level::Scalar).half_encode(&f, &out, 1);
+        return out;
+    }
+
+    float halfToFloat(const uint16_t h) {
+        float out;
+        kernels::get_vector_kernels(SIMD::Level::Scalar).half_decode(&h, &out, 1);
+        return out;
+    }
+
+    void encodeHalf(const std::span<const vec3f> in, const std::span<vec3h> out) {
+        checkSize(in.size(), out.size());
+        kernels::get_vector_kernels().half_encode(components(in), components(out), 3 * in.size());
+    }
+
+    void decodeHalf(const std::span<const vec3h> in, const std::span<vec3f> out) {
+        checkSize(in.size(), out.size());
+        kernels::get_vector_kernels().half_decode(components(in), components(out), 3 * in.size());
+    }
+
+    void encodeSnorm(const std::span<const vec3f> in, const std::span<vec3sn> out) {
+        checkSize(in.size(), out.size());
+        kernels::get_vector_kernels().snorm16_encode(components(in), components(out), 3 * in.size());
+    }
+
+    void decodeSnorm(const std::span<const vec3sn> in, const std::span<vec3f> out) {
+        checkSize(in.size(), out.size());
+        kernels::get_vector_kernels().snorm16_decode(components(in), components(out), 3 * in.size());
+    }
+
+    void encodeOctahedral(const std::span<const vec3f> in, const std::span<vec2sn> out) {
+        checkSize(in.size(), out.size());
+        kernels::get_vector_kernels().octahedral_encode(components(in), components(out), in.size());
+    }
+
+    void decodeOctahedral(const std::span<const vec2sn> in, const std::span<vec3f> out) {
+        checkSize(in.size(), out.size());
+        kernels::get_vector_kernels().octahedral_decode(components(in), components(out), in.size());
+    }
+}
@@ -0,0 +1,139 @@
+#include "engine-m/vector/vector_reduction.h"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+#include "engine-m/kernels.h"
+#include "parallel.h"
+
+namespace EngineM {
+
+    // Points per kernel call; the float partial sums of each block are folded into double.
+    static constexpr size_t block = 4096;
+
+    // Smallest share of points worth handing to a separate thread.
+    static constexpr size_t pointsPerThread = 1 << 16;
+
+    static void checkNotEmpty(const std::span<const vec3f> points) {
+        if (points.empty()) {
+            throw std::invalid_argument("Cannot reduce an empty span of points");
+        }
+    }
+
+    // Splits points into contiguous ranges, reduces each on its own thread and combines the
+    // partial results in order, so the result does not depend on thread timing.
+    template <typename Partial, typename Reduce, typename Combine>
+    static Partial reduce(const std::span<const vec3f> points, const Reduce &reduceRange, const Combine &combine) {
+        const size_t threads = parallelThreadCount(points.size(), pointsPerThread);
+        if (threads <= 1) {
+            return reduceRange(points);
+        }
+
+        std::vector<Partial> partials(threads);
+        const size_t ranges = parallelForRanges(points.size(), threads, 1, [&](const size_t t, const size_t begin, const size_t end) {
+            partials[t] = reduceRange(points.subspan(begin, end - begin));
+        });
+
+        Partial out = partials[0];
+        for (size_t t = 1; t < ranges; t++) {
+            out = combine(out, partials[t]);
+        }
+        return out;
+    }
+
+    AABB computeBounds(const std::span<const vec3f> points) {
+        checkNotEmpty(points);
+        const kernels::VectorKernels &vector = kernels::get_vector_kernels();
+        return reduce<AABB>(points, [&](const std::span<const vec3f> range) {
+            AABB out;
+            vector.reduce_bounds(range[0].data, range.size(), out.min.data, out.max.data);
+            return out;
+        }, [](const AABB &a, const AABB &b) {
+            AABB out;
+            for (int c = 0; c < 3; c++) {
+                out.min[c] = std::min(a.min[c], b.min[c]);
+                out.max[c] = std::max(a.max[c], b.max[c]);
+            }
+            return out;
+        });
+    }
+
+    static std::array<double, 3> sum(const std::span<const vec3f> points) {
+        const kernels::VectorKernels &vector = kernels::get_vector_kernels();
+        return reduce<std::array<double, 3>>(points, [&](const std::span<const vec3f> range) {
+            std::array<double, 3> out {};
+            for (size_t i = 0; i < range.size(); i += block) {
+                float partial[3];
+                vector.reduce_sum(range[i].data, std::min(block, range.size() - i), partial);
+                for (int c = 0; c < 3; c++) {
+                    out[c] += partial[c];
+                }
+            }
+            return out;
+        }, [](const std::array<double, 3> &a, const std::array<double, 3> &b) {
+            return std::array<double, 3> {a[0] + b[0], a[1] + b[1], a[2] + b[2]};
+        });
+    }
+
+    vec3f computeSum(const std::span<const vec3f> points) {
+        const std::array<double, 3> s = sum(points);
+        return {static_cast<float>(s[0]), static_cast<float>(s[1]), static_cast<float>(s[2])};
+    }
+
+    vec3f computeCentroid(const std::span<const vec3f> points) {
+        checkNotEmpty(points);
+        const std::array<double, 3> s = sum(points);
+        const auto n = static_cast<double>(points.size());
+        return {static_cast<float>(s[0] / n), static_cast<float>(s[1] / n), static_cast<float>(s[2] / n)};
+    }
+
+    mat3f computeCovariance(const std::span<const vec3f> points) {
+        // Centring on the centroid first keeps the float accumulation well conditioned.
+        const vec3f centre = computeCentroid(points);
+        const kernels::VectorKernels &vector = kernels::get_vector_kernels();
+        const std::array<double, 6> moments = reduce<std::array<double, 6>>(points, [&](const std::span<const vec3f> range) {
+            std::array<double, 6> out {};
+            for (size_t i = 0; i < range.size(); i += block) {
+                float partial[6];
+                vector.reduce_covariance(range[i].data, std::min(block, range.size() - i), centre.data, partial);
+                for (int k = 0; k < 6; k++) {
+                    out[k] += partial[k];
+                }
+            }
+            return out;
+        }, [](const std::array<double, 6> &a, const std::array<double, 6> &b) {
+            std::array<double, 6> out;
+            for (int k = 0; k < 6; k++) {
+                out[k] = a[k] + b[k];
+            }
+            return out;
+        });
+
+        const auto n = static_cast<double>(points.size());
+        const auto xx = static_cast<float>(moments[0] / n);
+        const auto xy = static_cast<float>(moments[1] / n);
+        const auto xz = static_cast<float>(moments[2] / n);
+        const auto yy = static_cast<float>(moments[3] / n);
+        const auto yz = static_cast<float>(moments[4] / n);
+        const auto zz = static_cast<float>(moments[5] / n);
+        return mat3f({
+            xx, xy, xz,
+            xy, yy, yz,
+            xz, yz, zz
+        });
+    }
+
+    DotRange computeDotRange(const std::span<const vec3f> points, const vec3f &direction) {
+        checkNotEmpty(points);
+        const kernels::VectorKernels &vector = kernels::get_vector_kernels();
+        return reduce<DotRange>(points, [&](const std::span<const vec3f> range) {
+            DotRange out {};
+            vector.reduce_dot_range(range[0].data, range.size(), direction.data, &out.min, &out.max);
+            return out;
+        }, [](const DotRange &a, const DotRange &b) {
+            return DotRange {std::min(a.min, b.min), std::max(a.max, b.max)};
+        });
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "engine-m/curves/curve.h"
+
+// Largest distance from dense samples of the curve to the polyline.
+inline float polylineError(const EngineM::Curve &curve, const std::vector<EngineM::vec3f> &polyline) {
+    float error = 0;
+    for (int s = 0; s <= 2000; s++) {
+        const EngineM::vec3f point = curve.evaluate(static_cast<float>(s) / 2000.f);
+        float closest = std::numeric_limits<float>::max();
+        for (size_t i = 0; i + 1 < polyline.size(); i++) {
+            const EngineM::vec3f chord = polyline[i + 1] - polyline[i];
+            const EngineM::vec3f offset = point - polyline[i];
+            const float along = std::clamp((offset * chord) / std::max(chord * chord, 1e-12f), 0.f, 1.f);
+            const EngineM::vec3f distance = offset - chord * along;
+            closest = std::min(closest, distance * distance);
+        }
+        error = std::max(error, std::sqrt(closest));
+    }
+    return error;
+}
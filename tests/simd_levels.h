@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+
+#include "engine-m/simd.h"
+
+// Every kernel level the processor supports, lowest first.
+inline std::vector<EngineM::SIMD::Level> supportedLevels() {
+    std::vector<EngineM::SIMD::Level> levels;
+    for (const EngineM::SIMD::Level level : {EngineM::SIMD::Level::Scalar, EngineM::SIMD::Level::SSE2, EngineM::SIMD::Level::AVX, EngineM::SIMD::Level::AVX2, EngineM::SIMD::Level::AVX2_FMA}) {
+        if (level <= EngineM::SIMD::get_simd_level()) {
+            levels.push_back(level);
+        }
+    }
+    return levels;
+}
+
+// Restores the active kernel level when it goes out of scope, so a failed assertion cannot
+// leave a forced level behind for later tests.
+class ActiveLevelGuard {
+    const EngineM::SIMD::Level previous = EngineM::SIMD::get_active_level();
+
+public:
+    ActiveLevelGuard() = default;
+    ActiveLevelGuard(const ActiveLevelGuard &) = delete;
+    ActiveLevelGuard& operator=(const ActiveLevelGuard &) = delete;
+
+    ~ActiveLevelGuard() {
+        EngineM::SIMD::set_active_level(previous);
+    }
+};
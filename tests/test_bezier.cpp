@@ -1,5 +1,13 @@
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 #include "engine-m/curves/bezier.h"
+#include "engine-m/simd.h"
+#include "engine-m/utils.h"
+#include "curve_checks.h"
+#include "simd_levels.h"
 
 static EngineM::vec3f tangentAt(const float t, const EngineM::vec3f &p0, const EngineM::vec3f &p1, const EngineM::vec3f &p2, const EngineM::vec3f &p3) {
     const float one_t = 1 - t;
@@ -8,10 +16,32 @@ static EngineM::vec3f tangentAt(const float t, const EngineM::vec3f &p0, const E
     return (p1 - p0) * (3 * one_t_sq) + (p2 - p1) * (6 * one_t * t) + (p3 - p2) * (3 * t * t);
 }
 
+static void expectVectorNear(const EngineM::vec3f &result, const EngineM::vec3f &expected) {
+    EXPECT_NEAR(result.x, expected.x, 1e-5f);
+    EXPECT_NEAR(result.y, expected.y, 1e-5f);
+    EXPECT_NEAR(result.z, expected.z, 1e-5f);
+}
+
+static void expectVectorClose(const EngineM::vec3f &result, const EngineM::vec3f &expected) {
+    for (int c = 0; c < 3; c++) {
+        EXPECT_NEAR(result[c], expected[c], 1e-4f * std::max(1.f, std::abs(expected[c])));
+    }
+}
+
 static EngineM::vec3f accelerationAt(const float t, const EngineM::vec3f &p0, const EngineM::vec3f &p1, const EngineM::vec3f &p2, const EngineM::vec3f &p3) {
     return (p2 - p1 * 2 + p0) * (6 * (1 - t)) + (p3 - p2 * 2 + p1) * (6 * t);
 }
 
+// degree + 1 control points along a wave, so every degree gives a curve bending in 3D.
+static std::vector<EngineM::vec3f> wavyControlPoints(const int degree) {
+    std::vector<EngineM::vec3f> points(degree + 1);
+    for (int i = 0; i <= degree; i++) {
+        const auto f = static_cast<float>(i);
+        points[i] = EngineM::vec3f(f * 2 - 3, std::sin(f) * 4, std::cos(f * 0.7f) * 3);
+    }
+    return points;
+}
+
 TEST(BezierTest, ParamConstruct1) {
     const EngineM::BezierCurve curve(3);
 
@@ -150,3 +180,223 @@ TEST(BezierTest, Acceleration) {
     EXPECT_FLOAT_EQ(result.y, acceleration.y);
     EXPECT_FLOAT_EQ(result.z, acceleration.z);
 }
+
+TEST(BezierTest, HodographsFollowControlPoints) {
+    std::vector<EngineM::vec3f> points = {{0, 0, 0}, {0, 1, 0}, {1, 0, 1}, {0, 0, 1}};
+    EngineM::BezierCurve curve(3, points);
+    const float t = 0.3f;
+
+    expectVectorNear(curve.tangentAt(t), tangentAt(t, points[0], points[1], points[2], points[3]));
+
+    curve[1] = points[1] = EngineM::vec3f(2, -1, 3);
+    expectVectorNear(curve.tangentAt(t), tangentAt(t, points[0], points[1], points[2], points[3]));
+    expectVectorNear(curve.accelerationAt(t), accelerationAt(t, points[0], points[1], points[2], points[3]));
+
+    points[3] = EngineM::vec3f(-4, 2, 0.5);
+    curve.setPoints(points);
+    expectVectorNear(curve.tangentAt(t), tangentAt(t, points[0], points[1], points[2], points[3]));
+    expectVectorNear(curve.accelerationAt(t), accelerationAt(t, points[0], points[1], points[2], points[3]));
+    expectVectorNear(curve.derivative() -> evaluate(t), curve.tangentAt(t));
+
+    // A copy carries its own cache.
+    EngineM::BezierCurve copy = curve;
+    copy[0] = EngineM::vec3f(1, 1, 1);
+    expectVectorNear(curve.tangentAt(t), tangentAt(t, points[0], points[1], points[2], points[3]));
+    EXPECT_NE(copy.tangentAt(t), curve.tangentAt(t));
+}
+
+TEST(BezierTest, PointReference) {
+    std::vector<EngineM::vec3f> points = {{0, 0, 0}, {0, 1, 0}, {1, 0, 1}, {0, 0, 1}};
+    EngineM::BezierCurve curve(3, points);
+    const float t = 0.5f;
+
+    // A reference kept across a const call still updates the curve.
+    auto point = curve[0];
+    expectVectorNear(curve.evaluate(t), EngineM::BezierCurve(3, points).evaluate(t));
+    point = points[0] = EngineM::vec3f(1, 2, 3);
+    expectVectorNear(curve.evaluate(t), EngineM::BezierCurve(3, points).evaluate(t));
+
+    curve[3] = curve[1];
+    const EngineM::vec3f &read = curve[3];
+    EXPECT_EQ(read, points[1]);
+    EXPECT_THROW(curve[4] = EngineM::vec3f(), std::invalid_argument);
+}
+
+TEST(BezierTest, ConcurrentEvaluation) {
+    std::vector<EngineM::vec3f> points = {{0, 0, 0}, {0, 1, 0}, {1, 0, 1}, {0, 0, 1}};
+    EngineM::BezierCurve curve(3, points);
+
+    // Every write rebuilds the cache straight away, so the threads below only read.
+    curve.setPoint(2, points[2] = EngineM::vec3f(3, 1, -2));
+    curve[1] = points[1] = EngineM::vec3f(2, -1, 3);
+    EXPECT_THROW(curve.setPoint(4, {}), std::invalid_argument);
+
+    const EngineM::BezierCurve &shared = curve;
+    std::vector<EngineM::vec3f> tangents(8);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < tangents.size(); i++) {
+        threads.emplace_back([&shared, &tangents, i] {
+            tangents[i] = shared.tangentAt(0.3f);
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    for (const EngineM::vec3f &tangent : tangents) {
+        expectVectorNear(tangent, tangentAt(0.3f, points[0], points[1], points[2], points[3]));
+    }
+}
+
+TEST(BezierTest, BinomialCoefficient) {
+    EXPECT_FLOAT_EQ(EngineM::binomialCoefficient(5, 2), 10);
+    EXPECT_FLOAT_EQ(EngineM::binomialCoefficient(40, 20), 137846528820.0f);
+    EXPECT_FLOAT_EQ(EngineM::binomialCoefficient(64, 32), 1832624140942590534.0f);
+    EXPECT_FLOAT_EQ(EngineM::binomialCoefficient(100, 50), 1.0089134454556419e29f);
+    EXPECT_FLOAT_EQ(EngineM::binomialCoefficient(100, 1), 100);
+    EXPECT_FLOAT_EQ(EngineM::binomialCoefficient(7, 8), 0);
+}
+
+TEST(BezierTest, HighDegree) {
+    // Degree 21 and up used to overflow the factorial-based coefficients.
+    for (const int degree : {21, 32, 40}) {
+        std::vector<EngineM::vec3f> points(degree + 1);
+        for (int i = 0; i <= degree; i++) {
+            const auto k = static_cast<float>(i);
+            points[i] = EngineM::vec3f(k, std::sin(k), std::cos(0.5f * k));
+        }
+        const EngineM::BezierCurve curve(degree, points);
+
+        for (const double t : {0.0, 0.05, 0.3, 0.5, 0.77, 1.0}) {
+            // Double-precision de Casteljau as the reference.
+            std::vector<double> x, y, z;
+            for (const EngineM::vec3f &p : points) {
+                x.push_back(p.x);
+                y.push_back(p.y);
+                z.push_back(p.z);
+            }
+            for (int r = degree; r > 0; r--) {
+                for (int i = 0; i < r; i++) {
+                    x[i] = (1 - t) * x[i] + t * x[i + 1];
+                    y[i] = (1 - t) * y[i] + t * y[i + 1];
+                    z[i] = (1 - t) * z[i] + t * z[i + 1];
+                }
+            }
+
+            const EngineM::vec3f result = curve.evaluate(static_cast<float>(t));
+            EXPECT_NEAR(result.x, x[0], 4e-6 * std::max(1.0, std::abs(x[0])));
+            EXPECT_NEAR(result.y, y[0], 4e-6 * std::max(1.0, std::abs(y[0])));
+            EXPECT_NEAR(result.z, z[0], 4e-6 * std::max(1.0, std::abs(z[0])));
+        }
+    }
+}
+
+TEST(BezierTest, EvaluateMany) {
+    // Parameters outside [0, 1] are clamped like the single-parameter calls.
+    std::vector<float> t(203);
+    for (size_t i = 0; i < t.size(); i++) {
+        t[i] = static_cast<float>(i) / 180.f - 0.05f;
+    }
+    std::vector<EngineM::vec3f> positions(t.size());
+    std::vector<EngineM::vec3f> tangents(t.size());
+    std::vector<EngineM::vec3f> accelerations(t.size());
+    std::vector<EngineM::Frame> frames(t.size());
+
+    const ActiveLevelGuard guard;
+
+    // Degrees up to BezierCurve::powerBasisDegree take the SIMD path, the rest loop.
+    for (int degree = 1; degree <= 7; degree++) {
+        const std::vector<EngineM::vec3f> points = wavyControlPoints(degree);
+        const EngineM::BezierCurve curve(degree, points);
+
+        for (const EngineM::SIMD::Level level : supportedLevels()) {
+            EngineM::SIMD::set_active_level(level);
+            curve.evaluateMany(t, positions);
+            curve.tangentMany(t, tangents);
+            curve.accelerationMany(t, accelerations);
+            curve.framesMany(t, frames);
+
+            for (size_t i = 0; i < t.size(); i++) {
+                expectVectorClose(positions[i], curve.evaluate(t[i]));
+                expectVectorClose(tangents[i], curve.tangentAt(t[i]));
+                expectVectorClose(accelerations[i], curve.accelerationAt(t[i]));
+                if (degree > 1) {
+                    const EngineM::Frame expected = curve.getFrenetFrame(t[i]);
+                    expectVectorClose(frames[i].origin, expected.origin);
+                    expectVectorClose(frames[i].tangent, expected.tangent);
+                    expectVectorClose(frames[i].normal, expected.normal);
+                }
+            }
+        }
+    }
+
+    std::vector<EngineM::vec3f> small(3);
+    const EngineM::BezierCurve curve(3);
+    EXPECT_THROW(curve.evaluateMany(t, small), std::invalid_argument);
+    EXPECT_THROW(curve.tangentMany(t, small), std::invalid_argument);
+    EXPECT_THROW(curve.accelerationMany(t, small), std::invalid_argument);
+}
+
+TEST(BezierTest, Tessellate) {
+    // Degree 0 is a constant curve with zero tangents.
+    for (int degree = 0; degree <= 7; degree++) {
+        const std::vector<EngineM::vec3f> points = wavyControlPoints(degree);
+        const EngineM::BezierCurve curve(degree, points);
+
+        for (const size_t count : {size_t(1), size_t(2), size_t(7), size_t(1000)}) {
+            std::vector<EngineM::vec3f> positions(count);
+            std::vector<EngineM::vec3f> tangents(count);
+            curve.tessellate(positions, tangents);
+
+            for (size_t i = 0; i < count; i++) {
+                const float t = count > 1 ? static_cast<float>(i) / static_cast<float>(count - 1) : 0.f;
+                expectVectorClose(positions[i], curve.evaluate(t));
+                expectVectorClose(tangents[i], curve.tangentAt(t));
+            }
+            expectVectorClose(positions.back(), count > 1 ? points.back() : points.front());
+        }
+    }
+
+    const EngineM::BezierCurve curve(3);
+    std::vector<EngineM::vec3f> positions(10);
+    std::vector<EngineM::vec3f> tangents(3);
+    curve.tessellate(positions, {});
+    EXPECT_THROW(curve.tessellate(positions, tangents), std::invalid_argument);
+}
+
+TEST(BezierTest, Flatten) {
+    std::vector<EngineM::vec3f> polyline;
+
+    // Collinear control points are flat at the first test.
+    const EngineM::BezierCurve line(3, {{0, 0, 0}, {1, 1, 1}, {2, 2, 2}, {3, 3, 3}});
+    line.flatten(polyline);
+    ASSERT_EQ(polyline.size(), 2);
+    EXPECT_EQ(polyline[0], EngineM::vec3f(0, 0, 0));
+    EXPECT_EQ(polyline[1], EngineM::vec3f(3, 3, 3));
+
+    for (int degree = 2; degree <= 7; degree++) {
+        const std::vector<EngineM::vec3f> points = wavyControlPoints(degree);
+        const EngineM::BezierCurve curve(degree, points);
+
+        size_t previous = 0;
+        for (const float tolerance : {EngineM::distance_tolerance, 0.05f, 0.01f}) {
+            curve.flatten(polyline, tolerance);
+            EXPECT_EQ(polyline.front(), points.front());
+            EXPECT_EQ(polyline.back(), points.back());
+            EXPECT_LE(polylineError(curve, polyline), tolerance);
+            EXPECT_GT(polyline.size(), previous);
+            previous = polyline.size();
+        }
+    }
+
+    // Past the stack capacity the subdivision works on the heap.
+    std::vector<EngineM::vec3f> points(21);
+    for (size_t i = 0; i < points.size(); i++) {
+        const auto f = static_cast<float>(i);
+        points[i] = EngineM::vec3f(f, std::sin(f) * 2, 0);
+    }
+    const EngineM::BezierCurve curve(20, points);
+    curve.flatten(polyline, 0.01f);
+    EXPECT_LE(polylineError(curve, polyline), 0.01f);
+
+    EXPECT_THROW(curve.flatten(polyline, 0), std::invalid_argument);
+}
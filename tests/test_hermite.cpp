@@ -1,5 +1,11 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
 #include <gtest/gtest.h>
 #include "engine-m/curves/hermite.h"
+#include "engine-m/simd.h"
+#include "curve_checks.h"
+#include "simd_levels.h"
 
 static EngineM::vec3f tangentAt(const float t, const EngineM::vec3f &p1, const EngineM::vec3f &p2, const EngineM::vec3f &v1, const EngineM::vec3f &v2) {
     const float tt = t * t;
@@ -212,3 +218,92 @@ TEST(HermiteTest, Acceleration) {
     EXPECT_FLOAT_EQ(result.y, acceleration.y);
     EXPECT_FLOAT_EQ(result.z, acceleration.z);
 }
+
+TEST(HermiteTest, EvaluateMany) {
+    const EngineM::vec3f p1(1, 2, 3);
+    const EngineM::vec3f p2(4, -5, 6);
+    const EngineM::vec3f v1(7, 8, -9);
+    const EngineM::vec3f v2(-10, 11, 12);
+    const EngineM::HermiteCurve curve(p1, p2, v1, v2);
+
+    std::vector<float> t(101);
+    for (size_t i = 0; i < t.size(); i++) {
+        t[i] = static_cast<float>(i) / 90.f - 0.05f;
+    }
+    std::vector<EngineM::vec3f> positions(t.size());
+    std::vector<EngineM::vec3f> tangents(t.size());
+    std::vector<EngineM::vec3f> accelerations(t.size());
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+        curve.evaluateMany(t, positions);
+        curve.tangentMany(t, tangents);
+        curve.accelerationMany(t, accelerations);
+
+        for (size_t i = 0; i < t.size(); i++) {
+            const float clamped = std::clamp(t[i], 0.f, 1.f);
+            const EngineM::vec3f position = curve.evaluate(clamped);
+            const EngineM::vec3f tangent = tangentAt(clamped, p1, p2, v1, v2);
+            const EngineM::vec3f acceleration = accelerationAt(clamped, p1, p2, v1, v2);
+            for (int c = 0; c < 3; c++) {
+                EXPECT_NEAR(positions[i][c], position[c], 1e-4f);
+                EXPECT_NEAR(tangents[i][c], tangent[c], 1e-4f);
+                EXPECT_NEAR(accelerations[i][c], acceleration[c], 1e-4f);
+            }
+        }
+    }
+
+    std::vector<EngineM::vec3f> small(3);
+    EXPECT_THROW(curve.evaluateMany(t, small), std::invalid_argument);
+}
+
+TEST(HermiteTest, Tessellate) {
+    const EngineM::vec3f p1(1, 2, 3);
+    const EngineM::vec3f p2(4, -5, 6);
+    const EngineM::vec3f v1(7, 8, -9);
+    const EngineM::vec3f v2(-10, 11, 12);
+    const EngineM::HermiteCurve curve(p1, p2, v1, v2);
+
+    for (const size_t count : {size_t(1), size_t(2), size_t(33), size_t(5000)}) {
+        std::vector<EngineM::vec3f> positions(count);
+        std::vector<EngineM::vec3f> tangents(count);
+        curve.tessellate(positions, tangents);
+
+        for (size_t i = 0; i < count; i++) {
+            const float t = count > 1 ? static_cast<float>(i) / static_cast<float>(count - 1) : 0.f;
+            const EngineM::vec3f position = curve.evaluate(t);
+            const EngineM::vec3f tangent = tangentAt(t, p1, p2, v1, v2);
+            for (int c = 0; c < 3; c++) {
+                EXPECT_NEAR(positions[i][c], position[c], 1e-4f);
+                EXPECT_NEAR(tangents[i][c], tangent[c], 1e-4f);
+            }
+        }
+    }
+
+    std::vector<EngineM::vec3f> positions(10);
+    std::vector<EngineM::vec3f> tangents(3);
+    EXPECT_THROW(curve.tessellate(positions, tangents), std::invalid_argument);
+}
+
+TEST(HermiteTest, Flatten) {
+    const EngineM::HermiteCurve curve({1, 2, 3}, {4, -5, 6}, {7, 8, -9}, {-10, 11, 12});
+    std::vector<EngineM::vec3f> polyline;
+
+    size_t previous = 0;
+    for (const float tolerance : {EngineM::distance_tolerance, 0.05f, 0.01f}) {
+        curve.flatten(polyline, tolerance);
+        EXPECT_EQ(polyline.front(), curve.getStart());
+        EXPECT_EQ(polyline.back(), curve.getEnd());
+        EXPECT_LE(polylineError(curve, polyline), tolerance);
+        EXPECT_GT(polyline.size(), previous);
+        previous = polyline.size();
+    }
+
+    const EngineM::HermiteCurve line({0, 0, 0}, {3, 0, 0}, {3, 0, 0}, {3, 0, 0});
+    line.flatten(polyline);
+    EXPECT_EQ(polyline.size(), 2);
+
+    EXPECT_THROW(curve.flatten(polyline, -1), std::invalid_argument);
+}
@@ -1,7 +1,10 @@
 #include <cstdint>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "engine-m/matrix/matrix.h"
+#include "engine-m/matrix/transform.h"
+#include "simd_levels.h"
 
 TEST(MatrixTest, DefaultConstruct) {
     const EngineM::mat3f matrix;
@@ -174,6 +177,70 @@ TEST(MatrixTest, ScalarDivEqual) {
     }
 }
 
+TEST(MatrixTest, Expression) {
+    const EngineM::mat3d a{3, 2, 1, 6, 5, 4, 9, 8, 7};
+    const EngineM::mat3d b{3, 4, 2, 5, 1, 9, 9, 2, 1};
+    const EngineM::mat3d c{1, 0, 2, 0, 1, 0, 4, 0, 1};
+
+    const EngineM::mat3d result = a * b + c * 2.0 - a / 4.0;
+    const EngineM::mat3d product = a * b;
+    for (uint32_t i = 0; i < 3; i++) {
+        for (uint32_t j = 0; j < 3; j++) {
+            EXPECT_DOUBLE_EQ(result[i][j], product[i][j] + c[i][j] * 2 - a[i][j] / 4);
+        }
+    }
+
+    // The destination may appear in the expression.
+    EngineM::mat3d d = a;
+    d = d + b * 2.0 - d;
+    EXPECT_EQ(d, b * 2.0);
+
+    d = a;
+    d += b - c;
+    EXPECT_EQ(d, a + b - c);
+
+    EXPECT_EQ((a + b) * c, EngineM::mat3d(a + b) * c);
+    EXPECT_EQ((a + b).eval(), EngineM::mat3d(a + b));
+    EXPECT_EQ(EngineM::mat3d(a / 0.0), EngineM::mat3d());
+
+    const EngineM::mat3f f1{3, 2, 1, 6, 5, 4, 9, 8, 7};
+    const EngineM::mat3f f2{3, 4, 2, 5, 1, 9, 9, 2, 1};
+    const EngineM::mat3f fused = f1 + f2 * 0.5f - f1 * 2.0f;
+    for (uint32_t i = 0; i < 3; i++) {
+        for (uint32_t j = 0; j < 3; j++) {
+            EXPECT_FLOAT_EQ(fused[i][j], f1[i][j] + f2[i][j] * 0.5f - f1[i][j] * 2.0f);
+        }
+    }
+}
+
+TEST(MatrixTest, ExpressionInterface) {
+    const EngineM::mat3d a{3, 2, 1, 6, 5, 4, 9, 8, 7};
+    const EngineM::mat3d b{3, 4, 2, 5, 1, 9, 9, 2, 1};
+    const EngineM::mat3d sum(a + b);
+
+    // Expressions answer the read-only Matrix interface.
+    EXPECT_DOUBLE_EQ((a + b)[1][2], sum[1][2]);
+    EXPECT_EQ((a * 2.0).transpose(), EngineM::mat3d(a * 2.0).getTranspose());
+    EXPECT_DOUBLE_EQ((a - b).determinant(), EngineM::mat3d(a - b).determinant());
+    EngineM::mat3d inverse;
+    EngineM::mat3d expected;
+    EXPECT_EQ((a + b).getInverse(inverse), sum.getInverse(expected));
+    EXPECT_EQ(inverse, expected);
+    EXPECT_TRUE(a + b == sum);
+    EXPECT_TRUE(a + b != a - b);
+
+    // Temporaries are captured by value, so the expression outlives them.
+    const auto e = EngineM::mat3d::identity() + a * 2.0;
+    EngineM::mat3d unrelated = b * 3.0;
+    const EngineM::mat3d result = e;
+    for (uint32_t i = 0; i < 3; i++) {
+        for (uint32_t j = 0; j < 3; j++) {
+            EXPECT_DOUBLE_EQ(result[i][j], (i == j ? 1 : 0) + a[i][j] * 2);
+        }
+    }
+    EXPECT_EQ(unrelated, b * 3.0);
+}
+
 TEST(MatrixTest, Mul) {
     const EngineM::mat3f m1{3, 2, 1, 6, 5, 4, 9, 8, 7};
     const EngineM::mat3f m2{3, 4, 2, 5, 1, 9, 9, 2, 1};
@@ -279,6 +346,175 @@ TEST(MatrixTest, Inverse) {
     }
 }
 
+TEST(MatrixTest, Mat4Inverse) {
+    const EngineM::mat4f m{4, 3, 2, 1, 0, 1, 2, 3, 1, 0, 2, 1, 2, 2, 0, 1};
+    const EngineM::mat4f singular{1, 2, 3, 4, 2, 4, 6, 8, 0, 1, 0, 1, 3, 0, 1, 2};
+
+    EXPECT_FLOAT_EQ(m.determinant(), 12);
+    EXPECT_FLOAT_EQ(singular.determinant(), 0);
+
+    EngineM::mat4f result;
+    EXPECT_FALSE(singular.getInverse(result));
+    EXPECT_TRUE(m.getInverse(result));
+    EXPECT_EQ(m * result, EngineM::mat4f::identity());
+}
+
+TEST(MatrixTest, LUDecomposition) {
+    const EngineM::Matrix<double, 5, 5> m{2, 1, 0, 0, 3, 1, 4, 1, 0, 0, 0, 1, 5, 2, 1, 3, 0, 2, 6, 1, 1, 2, 0, 1, 7};
+    const EngineM::Matrix<int, 5, 5> mi{2, 1, 0, 0, 3, 1, 4, 1, 0, 0, 0, 1, 5, 2, 1, 3, 0, 2, 6, 1, 1, 2, 0, 1, 7};
+
+    EXPECT_NEAR(m.determinant(), 1219, 1e-9);
+    EXPECT_EQ(mi.determinant(), 1219);
+
+    const EngineM::LUDecomposition<double, 5> lu(m);
+    EXPECT_FALSE(lu.isSingular());
+
+    // PA = LU
+    const EngineM::Matrix<double, 5, 5> product = lu.getLower() * lu.getUpper();
+    for (uint32_t i = 0; i < 5; i++) {
+        for (uint32_t j = 0; j < 5; j++) {
+            EXPECT_NEAR(product[i][j], m[lu.getPivot(i)][j], 1e-12);
+        }
+    }
+
+    const EngineM::Vector<double, 5> x(EngineM::Vector<double, 4>(1, -2, 3, 0.5), -1);
+    EngineM::Vector<double, 5> solved;
+    EXPECT_TRUE(lu.solve(m * x, solved));
+    for (uint32_t i = 0; i < 5; i++) {
+        EXPECT_NEAR(solved[i], x[i], 1e-12);
+    }
+
+    EngineM::Matrix<double, 5, 5> inv;
+    EXPECT_TRUE(m.getInverse(inv));
+    const EngineM::Matrix<double, 5, 5> identity = m * inv;
+    for (uint32_t i = 0; i < 5; i++) {
+        for (uint32_t j = 0; j < 5; j++) {
+            EXPECT_NEAR(identity[i][j], i == j ? 1 : 0, 1e-12);
+        }
+    }
+
+    EngineM::Matrix<double, 5, 5> singular = m;
+    for (uint32_t j = 0; j < 5; j++) {
+        singular[4][j] = singular[0][j] + singular[1][j];
+    }
+    // Rank deficient up to rounding: solve refuses, the determinant is only rounding error.
+    const EngineM::LUDecomposition<double, 5> singularLU(singular);
+    EXPECT_TRUE(singularLU.isSingular());
+    EXPECT_FALSE(singularLU.solve(m * x, solved));
+    EXPECT_NEAR(singularLU.determinant(), 0, 1e-9);
+
+    // A repeated row leaves an exactly zero pivot, which has no determinant or inverse.
+    for (uint32_t j = 0; j < 5; j++) {
+        singular[4][j] = singular[2][j];
+    }
+    EXPECT_EQ(singular.determinant(), 0);
+    EXPECT_FALSE(singular.getInverse(inv));
+}
+
+TEST(MatrixTest, BadlyScaledDeterminant) {
+    // Nonsingular, so the LU path must agree with the closed-form 4x4 result.
+    EngineM::Matrix<float, 5, 5> m;
+    EngineM::mat4f m4;
+    const float diagonal[5] = {1e4f, 1e-4f, 1, 1, 1};
+    for (uint32_t i = 0; i < 5; i++) {
+        m[i][i] = diagonal[i];
+        if (i < 4) {
+            m4[i][i] = diagonal[i];
+        }
+    }
+
+    EXPECT_FLOAT_EQ(m4.determinant(), 1);
+    EXPECT_FLOAT_EQ(m.determinant(), 1);
+    const EngineM::LUDecomposition<float, 5> lu(m);
+    EXPECT_FALSE(lu.isSingular());
+
+    EngineM::Matrix<float, 5, 5> inv;
+    EXPECT_TRUE(m.getInverse(inv));
+    for (uint32_t i = 0; i < 5; i++) {
+        EXPECT_FLOAT_EQ(inv[i][i], 1 / diagonal[i]);
+    }
+
+    EngineM::Vector<float, 5> solved;
+    EXPECT_TRUE(m.solve(EngineM::Vector<float, 5>(EngineM::Vector<float, 4>(1e4f, 1e-4f, 1, 1), 1), solved));
+    for (uint32_t i = 0; i < 5; i++) {
+        EXPECT_FLOAT_EQ(solved[i], 1);
+    }
+}
+
+TEST(MatrixTest, Solve) {
+    const EngineM::mat3f m{3, 4, 2, 5, 1, 9, 9, 2, 1};
+    const EngineM::vec3f x(1, -2, 0.5f);
+
+    EngineM::vec3f solved;
+    EXPECT_TRUE(m.solve(m * x, solved));
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_NEAR(solved[i], x[i], 1e-5);
+    }
+
+    const EngineM::mat3f singular{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_FALSE(singular.solve(x, solved));
+}
+
+TEST(MatrixTest, SolveCholesky) {
+    const EngineM::Matrix<double, 4, 4> spd{4, 1, 2, 0.5, 1, 5, 1, 1, 2, 1, 6, 2, 0.5, 1, 2, 7};
+    const EngineM::Vector<double, 4> x(1, -1, 2, 0.25);
+
+    const EngineM::CholeskyDecomposition<double, 4> cholesky(spd);
+    EXPECT_TRUE(cholesky.isPositiveDefinite());
+
+    const EngineM::Matrix<double, 4, 4> lower = cholesky.getLower();
+    const EngineM::Matrix<double, 4, 4> product = lower * lower.getTranspose();
+    for (uint32_t i = 0; i < 4; i++) {
+        for (uint32_t j = 0; j < 4; j++) {
+            EXPECT_NEAR(product[i][j], spd[i][j], 1e-12);
+        }
+    }
+
+    EngineM::Vector<double, 4> solved;
+    EXPECT_TRUE(spd.solveCholesky(spd * x, solved));
+    for (uint32_t i = 0; i < 4; i++) {
+        EXPECT_NEAR(solved[i], x[i], 1e-12);
+    }
+
+    const EngineM::Matrix<double, 4, 4> indefinite{1, 2, 0, 0, 2, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+    EXPECT_FALSE(indefinite.solveCholesky(x, solved));
+}
+
+TEST(MatrixTest, SolveLeastSquares) {
+    // Fit y = a + b * t through points that lie exactly on y = 2 - 3t, then through noisy ones.
+    EngineM::Matrix<double, 6, 2> design;
+    EngineM::Vector<double, 6> exact;
+    EngineM::Vector<double, 6> noisy;
+    const double noise[6] = {0.1, -0.1, 0.1, -0.1, 0.1, -0.1};
+    for (uint32_t i = 0; i < 6; i++) {
+        design[i][0] = 1;
+        design[i][1] = i;
+        exact[i] = 2 - 3.0 * i;
+        noisy[i] = exact[i] + noise[i];
+    }
+
+    EngineM::Vector<double, 2> coefficients;
+    EXPECT_TRUE(design.solveLeastSquares(exact, coefficients));
+    EXPECT_NEAR(coefficients[0], 2, 1e-12);
+    EXPECT_NEAR(coefficients[1], -3, 1e-12);
+
+    // The residual of a least-squares solution is orthogonal to the columns of A.
+    EXPECT_TRUE(design.solveLeastSquares(noisy, coefficients));
+    const EngineM::Vector<double, 6> residual = noisy - design * coefficients;
+    for (uint32_t j = 0; j < 2; j++) {
+        double dot = 0;
+        for (uint32_t i = 0; i < 6; i++) {
+            dot += design[i][j] * residual[i];
+        }
+        EXPECT_NEAR(dot, 0, 1e-12);
+    }
+
+    for (uint32_t i = 0; i < 6; i++) {
+        design[i][1] = 2 * design[i][0];
+    }
+    EXPECT_FALSE(design.solveLeastSquares(exact, coefficients));
+}
+
 TEST(MatrixTest, GetTranspose) {
     const EngineM::mat3f m1{1, 2, 3, 4, 5, 6, 7, 8, 9};
     const EngineM::mat3f result = m1.getTranspose();
@@ -347,3 +583,225 @@ TEST(MatrixTest, DifferentDimensionsMulEqual) {
         }
     }
 }
+
+TEST(MatrixTest, Constexpr) {
+    constexpr EngineM::mat3f m1{3, 2, 1, 6, 5, 4, 9, 8, 7};
+    constexpr EngineM::mat3f m2{3, 4, 2, 5, 1, 9, 9, 2, 1};
+    constexpr EngineM::mat3f sum = m1 + m2 * 2.0f;
+    constexpr EngineM::mat3f product = m1 * m2;
+    static_assert(sum[1][2] == 22);
+    static_assert(product[0][0] == 28);
+    static_assert(m2.determinant() == 255);
+
+    constexpr EngineM::mat4f basis{0, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1};
+    constexpr EngineM::mat4f inverse = [&] {
+        EngineM::mat4f out;
+        basis.getInverse(out);
+        return out;
+    }();
+    static_assert(basis * inverse == EngineM::mat4f::identity());
+    static_assert(inverse == basis.getTranspose());
+    static_assert((basis * EngineM::vec4f(1, 2, 3, 1))[0] == 3);
+
+    constexpr EngineM::Matrix<int, 5, 5> mi{2, 1, 0, 0, 3, 1, 4, 1, 0, 0, 0, 1, 5, 2, 1, 3, 0, 2, 6, 1, 1, 2, 0, 1, 7};
+    static_assert(mi.determinant() == 1219);
+
+    EXPECT_EQ(product, m1 * m2);
+}
+
+TEST(MatrixTest, DispatchedKernels) {
+    const EngineM::mat3f m1{3, 2, 1, 6, 5, 4, 9, 8, 7};
+    const EngineM::mat3f m2{3, 4, 2, 5, 1, 9, 9, 2, 1};
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EXPECT_EQ(EngineM::SIMD::set_active_level(level), level);
+
+        const EngineM::mat3f sum = m1 + m2;
+        const EngineM::mat3f diff = m1 - m2;
+        const EngineM::mat3f scaled = m1 * 3.2f;
+        const EngineM::mat3f product = m1 * m2;
+
+        for (uint32_t i = 0; i < 3; i++) {
+            for (uint32_t j = 0; j < 3; j++) {
+                float sum_ij = 0;
+                for (uint32_t k = 0; k < 3; k++) {
+                    sum_ij += m1[i][k] * m2[k][j];
+                }
+                EXPECT_FLOAT_EQ(sum[i][j], m1[i][j] + m2[i][j]);
+                EXPECT_FLOAT_EQ(diff[i][j], m1[i][j] - m2[i][j]);
+                EXPECT_FLOAT_EQ(scaled[i][j], m1[i][j] * 3.2f);
+                EXPECT_FLOAT_EQ(product[i][j], sum_ij);
+            }
+        }
+    }
+}
+
+TEST(MatrixTest, SetActiveLevelClamps) {
+    const ActiveLevelGuard guard;
+
+    EXPECT_EQ(EngineM::SIMD::set_active_level(EngineM::SIMD::Level::AVX2_FMA), EngineM::SIMD::get_simd_level());
+    EXPECT_EQ(EngineM::SIMD::get_active_level(), EngineM::SIMD::get_simd_level());
+}
+
+TEST(MatrixTest, Mat4DispatchedKernels) {
+    const EngineM::mat4f m1{3, 2, 1, 4, 6, 5, 4, 2, 9, 8, 7, 1, 2, 3, 5, 7};
+    const EngineM::mat4f m2{3, 4, 2, 1, 5, 1, 9, 3, 9, 2, 1, 6, 4, 8, 2, 5};
+    const EngineM::vec4f v(4, 3, 2, 1);
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        const EngineM::mat4f sum = m1 + m2;
+        const EngineM::mat4f diff = m1 - m2;
+        const EngineM::mat4f scaled = m1 * 3.2f;
+        const EngineM::mat4f product = m1 * m2;
+        const EngineM::mat4f transpose = m1.getTranspose();
+        const EngineM::vec4f transformed = m1 * v;
+
+        for (uint32_t i = 0; i < 4; i++) {
+            float dot = 0;
+            for (uint32_t j = 0; j < 4; j++) {
+                float sum_ij = 0;
+                for (uint32_t k = 0; k < 4; k++) {
+                    sum_ij += m1[i][k] * m2[k][j];
+                }
+                dot += m1[i][j] * v[j];
+                EXPECT_FLOAT_EQ(sum[i][j], m1[i][j] + m2[i][j]);
+                EXPECT_FLOAT_EQ(diff[i][j], m1[i][j] - m2[i][j]);
+                EXPECT_FLOAT_EQ(scaled[i][j], m1[i][j] * 3.2f);
+                EXPECT_FLOAT_EQ(product[i][j], sum_ij);
+                EXPECT_FLOAT_EQ(transpose[i][j], m1[j][i]);
+            }
+            EXPECT_FLOAT_EQ(transformed[i], dot);
+        }
+    }
+}
+
+TEST(MatrixTest, PaddedLayout) {
+    static_assert(sizeof(EngineM::mat3fa) == 12 * sizeof(float));
+    static_assert(alignof(EngineM::mat3fa) == 16);
+    static_assert(sizeof(EngineM::mat4fa) == 16 * sizeof(float));
+    static_assert(alignof(EngineM::mat4fa) == 32);
+
+    const EngineM::mat3f packed{3, 2, 1, 6, 5, 4, 9, 8, 7};
+    const EngineM::mat3fa padded(packed);
+    const EngineM::mat3f roundtrip(padded);
+
+    for (uint32_t i = 0; i < 3; i++) {
+        for (uint32_t j = 0; j < 3; j++) {
+            EXPECT_FLOAT_EQ(padded[i][j], packed[i][j]);
+        }
+    }
+    EXPECT_EQ(roundtrip, packed);
+    EXPECT_FLOAT_EQ(padded.determinant(), packed.determinant());
+}
+
+TEST(MatrixTest, PaddedDispatchedKernels) {
+    const EngineM::mat3fa m1{3, 2, 1, 6, 5, 4, 9, 8, 7};
+    const EngineM::mat3fa m2{3, 4, 2, 5, 1, 9, 9, 2, 1};
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        const EngineM::mat3fa sum = m1 + m2;
+        const EngineM::mat3fa diff = m1 - m2;
+        const EngineM::mat3fa scaled = m1 * 3.2f;
+        const EngineM::mat3fa product = m1 * m2;
+
+        for (uint32_t i = 0; i < 3; i++) {
+            for (uint32_t j = 0; j < 3; j++) {
+                float sum_ij = 0;
+                for (uint32_t k = 0; k < 3; k++) {
+                    sum_ij += m1[i][k] * m2[k][j];
+                }
+                EXPECT_FLOAT_EQ(sum[i][j], m1[i][j] + m2[i][j]);
+                EXPECT_FLOAT_EQ(diff[i][j], m1[i][j] - m2[i][j]);
+                EXPECT_FLOAT_EQ(scaled[i][j], m1[i][j] * 3.2f);
+                EXPECT_FLOAT_EQ(product[i][j], sum_ij);
+            }
+        }
+    }
+}
+
+TEST(MatrixTest, Mat4AffineInverse) {
+    const EngineM::mat4f m{0, -2, 0, 5, 1, 0, 0, -3, 0, 0, 4, 2, 0, 0, 0, 1};
+    const EngineM::mat4f singular{1, 2, 3, 1, 2, 4, 6, 1, 0, 0, 1, 1, 0, 0, 0, 1};
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        EngineM::mat4f inverse;
+        EXPECT_TRUE(m.getAffineInverse(inverse));
+        EXPECT_TRUE(m * inverse == EngineM::mat4f::identity());
+        EXPECT_TRUE(inverse * m == EngineM::mat4f::identity());
+
+        EngineM::mat4f copy = m;
+        EXPECT_TRUE(copy.affineInverse());
+        EXPECT_TRUE(copy == inverse);
+
+        EXPECT_FALSE(singular.getAffineInverse(inverse));
+    }
+
+    const EngineM::mat4d md{0, -2, 0, 5, 1, 0, 0, -3, 0, 0, 4, 2, 0, 0, 0, 1};
+    EngineM::mat4d inverse;
+    EXPECT_TRUE(md.getAffineInverse(inverse));
+    EXPECT_TRUE(md * inverse == EngineM::mat4d::identity());
+}
+
+TEST(MatrixTest, TransformPoints) {
+    const EngineM::mat3f m3{0.5f, -1, 2, 3, 0.25f, -2, 1, 1, 4};
+    const EngineM::mat4f m4{0.5f, -1, 2, 7, 3, 0.25f, -2, -5, 1, 1, 4, 0.5f, 0, 0, 0, 1};
+
+    std::vector<EngineM::vec3f> points;
+    for (int i = 0; i < 37; i++) {
+        points.emplace_back(static_cast<float>(i) * 0.5f - 4, static_cast<float>(i % 5) - 2, 3 - static_cast<float>(i % 7));
+    }
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        std::vector<EngineM::vec3f> rotated(points.size());
+        std::vector<EngineM::vec3f> transformed = points;
+        EngineM::transformPoints(m3, points, rotated);
+        EngineM::transformPoints(m4, transformed, transformed);
+
+        std::vector<float> x, y, z;
+        for (const EngineM::vec3f &p : points) {
+            x.push_back(p.x);
+            y.push_back(p.y);
+            z.push_back(p.z);
+        }
+        std::vector<float> outX(x.size()), outY(y.size()), outZ(z.size());
+        EngineM::transformPoints(m4, x, y, z, outX, outY, outZ);
+
+        for (size_t n = 0; n < points.size(); n++) {
+            const EngineM::vec3f expectedRotated = m3 * points[n];
+            const EngineM::vec4f expectedTransformed = m4 * EngineM::vec4f(points[n], 1);
+
+            EXPECT_FLOAT_EQ(rotated[n].x, expectedRotated.x);
+            EXPECT_FLOAT_EQ(rotated[n].y, expectedRotated.y);
+            EXPECT_FLOAT_EQ(rotated[n].z, expectedRotated.z);
+
+            EXPECT_FLOAT_EQ(transformed[n].x, expectedTransformed.x);
+            EXPECT_FLOAT_EQ(transformed[n].y, expectedTransformed.y);
+            EXPECT_FLOAT_EQ(transformed[n].z, expectedTransformed.z);
+
+            EXPECT_FLOAT_EQ(outX[n], expectedTransformed.x);
+            EXPECT_FLOAT_EQ(outY[n], expectedTransformed.y);
+            EXPECT_FLOAT_EQ(outZ[n], expectedTransformed.z);
+        }
+    }
+
+    std::vector<EngineM::vec3f> out(points.size() - 1);
+    EXPECT_THROW(EngineM::transformPoints(m3, points, out), std::invalid_argument);
+}
@@ -0,0 +1,143 @@
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "engine-m/matrix/matrix_array.h"
+#include "simd_levels.h"
+
+static std::vector<EngineM::mat3f> makeMatrices(const size_t count, const float seed) {
+    std::vector<EngineM::mat3f> matrices(count);
+    for (size_t n = 0; n < count; n++) {
+        for (uint32_t i = 0; i < 3; i++) {
+            for (uint32_t j = 0; j < 3; j++) {
+                matrices[n][i][j] = seed + static_cast<float>((n * 7 + i * 3 + j) % 11) - 5;
+            }
+        }
+    }
+    return matrices;
+}
+
+static void expectMatrixEq(const EngineM::mat3f &result, const EngineM::mat3f &expected) {
+    for (uint32_t i = 0; i < 3; i++) {
+        for (uint32_t j = 0; j < 3; j++) {
+            EXPECT_FLOAT_EQ(result[i][j], expected[i][j]);
+        }
+    }
+}
+
+TEST(MatrixArrayTest, SizeConstruct) {
+    const EngineM::MatrixArray array(13);
+
+    EXPECT_EQ(array.size(), 13);
+    EXPECT_EQ(array.getStride() % EngineM::MatrixArray::lanes, 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(array.stream(0, 0)) % EngineM::MatrixArray::alignment, 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(array.stream(2, 2)) % EngineM::MatrixArray::alignment, 0);
+
+    for (size_t n = 0; n < array.size(); n++) {
+        expectMatrixEq(array.get(n), EngineM::mat3f());
+    }
+}
+
+TEST(MatrixArrayTest, RoundTrip) {
+    const std::vector<EngineM::mat3f> matrices = makeMatrices(19, 1);
+    const EngineM::MatrixArray array(matrices);
+
+    std::vector<EngineM::mat3f> result(matrices.size());
+    array.toMatrices(result);
+
+    for (size_t n = 0; n < matrices.size(); n++) {
+        expectMatrixEq(result[n], matrices[n]);
+    }
+}
+
+TEST(MatrixArrayTest, CopyAndMove) {
+    const std::vector<EngineM::mat3f> matrices = makeMatrices(5, 2);
+    EngineM::MatrixArray array1(matrices);
+    const EngineM::MatrixArray array2(array1);
+    const EngineM::MatrixArray array3(std::move(array1));
+
+    EXPECT_EQ(array1.size(), 0);
+    for (size_t n = 0; n < matrices.size(); n++) {
+        expectMatrixEq(array2.get(n), matrices[n]);
+        expectMatrixEq(array3.get(n), matrices[n]);
+    }
+}
+
+TEST(MatrixArrayTest, Arithmetic) {
+    const std::vector<EngineM::mat3f> a = makeMatrices(21, 1);
+    const std::vector<EngineM::mat3f> b = makeMatrices(21, 3);
+    const EngineM::MatrixArray arrayA(a);
+    const EngineM::MatrixArray arrayB(b);
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        const EngineM::MatrixArray sum = arrayA + arrayB;
+        const EngineM::MatrixArray diff = arrayA - arrayB;
+        const EngineM::MatrixArray scaled = arrayA * 1.5f;
+        const EngineM::MatrixArray product = arrayA * arrayB;
+
+        EngineM::MatrixArray inPlace = arrayA;
+        inPlace *= arrayB;
+
+        for (size_t n = 0; n < a.size(); n++) {
+            EngineM::SIMD::set_active_level(EngineM::SIMD::Level::Scalar);
+            const EngineM::mat3f expectedSum = a[n] + b[n];
+            const EngineM::mat3f expectedDiff = a[n] - b[n];
+            const EngineM::mat3f expectedScaled = a[n] * 1.5f;
+            const EngineM::mat3f expectedProduct = a[n] * b[n];
+            EngineM::SIMD::set_active_level(level);
+
+            expectMatrixEq(sum.get(n), expectedSum);
+            expectMatrixEq(diff.get(n), expectedDiff);
+            expectMatrixEq(scaled.get(n), expectedScaled);
+            expectMatrixEq(product.get(n), expectedProduct);
+            expectMatrixEq(inPlace.get(n), expectedProduct);
+        }
+    }
+}
+
+TEST(MatrixArrayTest, SizeMismatch) {
+    EngineM::MatrixArray array1(4);
+    const EngineM::MatrixArray array2(5);
+
+    EXPECT_THROW(array1 += array2, std::invalid_argument);
+    EXPECT_THROW(array1 *= array2, std::invalid_argument);
+}
+
+TEST(MatrixArrayTest, Batch) {
+    const std::vector<EngineM::mat3f> a = makeMatrices(11, 1);
+    const std::vector<EngineM::mat3f> b = makeMatrices(11, 4);
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        std::vector<EngineM::mat3f> sum(a.size());
+        std::vector<EngineM::mat3f> diff(a.size());
+        std::vector<EngineM::mat3f> scaled(a.size());
+        std::vector<EngineM::mat3f> product(a.size());
+        std::vector<EngineM::mat3f> inPlace = a;
+
+        EngineM::addBatch(a, b, sum);
+        EngineM::subBatch(a, b, diff);
+        EngineM::mulBatch(a, 0.5f, scaled);
+        EngineM::mulBatch(a, b, product);
+        EngineM::mulBatch(inPlace, b, inPlace);
+
+        EngineM::SIMD::set_active_level(EngineM::SIMD::Level::Scalar);
+        for (size_t n = 0; n < a.size(); n++) {
+            expectMatrixEq(sum[n], a[n] + b[n]);
+            expectMatrixEq(diff[n], a[n] - b[n]);
+            expectMatrixEq(scaled[n], a[n] * 0.5f);
+            expectMatrixEq(product[n], a[n] * b[n]);
+            expectMatrixEq(inPlace[n], a[n] * b[n]);
+        }
+    }
+
+    std::vector<EngineM::mat3f> out(a.size() - 1);
+    EXPECT_THROW(EngineM::addBatch(a, b, out), std::invalid_argument);
+}
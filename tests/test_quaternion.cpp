@@ -1,7 +1,31 @@
 #include <cmath>
+#include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 
+#include "engine-m/simd.h"
+#include "engine-m/quaternion/interpolation.h"
 #include "engine-m/quaternion/quaternion.h"
+#include "engine-m/quaternion/rotation.h"
+#include "simd_levels.h"
+
+static EngineM::Quaternion axisAngle(EngineM::vec3f axis, const float angle) {
+    axis.normalise();
+    return {std::cos(angle / 2), axis * std::sin(angle / 2)};
+}
+
+static void expectVectorNear(const EngineM::vec3f &result, const EngineM::vec3f &expected) {
+    EXPECT_NEAR(result.x, expected.x, 1e-5f);
+    EXPECT_NEAR(result.y, expected.y, 1e-5f);
+    EXPECT_NEAR(result.z, expected.z, 1e-5f);
+}
+
+static void expectQuaternionNear(const EngineM::Quaternion &result, const EngineM::Quaternion &expected, const float tolerance) {
+    EXPECT_NEAR(result.a, expected.a, tolerance);
+    EXPECT_NEAR(result.v.x, expected.v.x, tolerance);
+    EXPECT_NEAR(result.v.y, expected.v.y, tolerance);
+    EXPECT_NEAR(result.v.z, expected.v.z, tolerance);
+}
 
 TEST(QuaternionTest, DefaultConstruct) {
     const EngineM::Quaternion q;
@@ -31,6 +55,19 @@ TEST(QuaternionTest, CopyConstruct) {
     EXPECT_FLOAT_EQ(q1.v.z, q2.v.z);
 }
 
+TEST(QuaternionTest, Data) {
+    EngineM::Quaternion q(1, EngineM::vec3f(2, 3, 4));
+    const float *data = std::as_const(q).data();
+
+    EXPECT_FLOAT_EQ(data[0], 2);
+    EXPECT_FLOAT_EQ(data[1], 3);
+    EXPECT_FLOAT_EQ(data[2], 4);
+    EXPECT_FLOAT_EQ(data[3], 1);
+
+    q.data()[3] = 5;
+    EXPECT_FLOAT_EQ(q.a, 5);
+}
+
 TEST(QuaternionTest, AssignmentOp) {
     EngineM::Quaternion q1;
     const EngineM::Quaternion q2(1, EngineM::vec3f(2, 3, 4));
@@ -231,3 +268,213 @@ TEST(QuaternionTest, Inverse) {
     EXPECT_FLOAT_EQ(result.v.y, -q.v.y / n);
     EXPECT_FLOAT_EQ(result.v.z, -q.v.z / n);
 }
+
+TEST(QuaternionTest, Constexpr) {
+    constexpr EngineM::Quaternion q1(4.2, EngineM::vec3f(2.1, 6.3, 4.2));
+    constexpr EngineM::Quaternion q2(15.3, EngineM::vec3f(2.0, 3.2, 4.0));
+    constexpr EngineM::Quaternion product = q1 * q2;
+    constexpr EngineM::Quaternion identity = q1 * q1.inverse();
+
+    constexpr EngineM::Quaternion expected(q1.a * q2.a - q1.v * q2.v, q1.v * q2.a + q2.v * q1.a + (q1.v ^ q2.v));
+
+    // The product is summed in SSE lane order, so compare to the textbook formula to a relative tolerance.
+    constexpr auto near = [](const float x, const float y) {
+        const float d = x - y;
+        return (d < 0 ? -d : d) <= 1e-6f * (y < 0 ? -y : y);
+    };
+    static_assert(near(product.a, expected.a));
+    static_assert(near(product.v[0], expected.v[0]) && near(product.v[1], expected.v[1]) && near(product.v[2], expected.v[2]));
+    static_assert(EngineM::equals(identity.a, 1));
+    static_assert(EngineM::equals(identity.v[0], 0) && EngineM::equals(identity.v[1], 0) && EngineM::equals(identity.v[2], 0));
+
+    EXPECT_EQ(product, q1 * q2);
+}
+
+TEST(QuaternionTest, Rotate) {
+    const EngineM::Quaternion quarter = axisAngle(EngineM::vec3f(0, 0, 1), static_cast<float>(M_PI / 2));
+    expectVectorNear(quarter.rotate(EngineM::vec3f(1, 0, 0)), EngineM::vec3f(0, 1, 0));
+
+    const EngineM::Quaternion q = axisAngle(EngineM::vec3f(1, -2, 0.5), 0.83f);
+    const EngineM::vec3f p(3.5, -1.25, 2);
+    const EngineM::Quaternion sandwich = q * EngineM::Quaternion(0, p) * q.inverse();
+
+    expectVectorNear(q.rotate(p), sandwich.v);
+}
+
+TEST(QuaternionTest, RotatePoints) {
+    std::vector<EngineM::vec3f> points(29);
+    std::vector<EngineM::Quaternion> rotations(points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+        const auto t = static_cast<float>(i);
+        points[i] = EngineM::vec3f(t - 14, 0.5f * t, 3 - 0.25f * t);
+        rotations[i] = axisAngle(EngineM::vec3f(std::sin(t), 1, std::cos(t)), 0.2f * t);
+    }
+    const EngineM::Quaternion q = axisAngle(EngineM::vec3f(0.3, 1, -0.7), 1.9f);
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        std::vector<EngineM::vec3f> single(points.size());
+        std::vector<EngineM::vec3f> each = points;
+        EngineM::rotatePoints(q, points, single);
+        EngineM::rotatePoints(rotations, each, each);
+
+        for (size_t i = 0; i < points.size(); i++) {
+            expectVectorNear(single[i], q.rotate(points[i]));
+            expectVectorNear(each[i], rotations[i].rotate(points[i]));
+        }
+    }
+
+    std::vector<EngineM::vec3f> out(points.size() - 1);
+    EXPECT_THROW(EngineM::rotatePoints(q, points, out), std::invalid_argument);
+    EXPECT_THROW(EngineM::rotatePoints(rotations, points, out), std::invalid_argument);
+}
+
+TEST(QuaternionTest, Slerp) {
+    const EngineM::vec3f axis(1, 2, -0.5);
+    const EngineM::Quaternion a = axisAngle(axis, 0.4f);
+    const EngineM::Quaternion b = axisAngle(axis, 2.8f);
+
+    expectQuaternionNear(EngineM::slerp(a, b, 0), a, 1e-6f);
+    expectQuaternionNear(EngineM::slerp(a, b, 1), b, 1e-6f);
+    expectQuaternionNear(EngineM::slerp(a, b, 0.25f), axisAngle(axis, 1.0f), 1e-6f);
+
+    // -b is the same rotation, so the shorter arc gives the same result.
+    expectQuaternionNear(EngineM::slerp(a, b * -1, 0.25f), axisAngle(axis, 1.0f), 1e-6f);
+    expectQuaternionNear(EngineM::slerp(a, a, 0.5f), a, 1e-6f);
+}
+
+TEST(QuaternionTest, Nlerp) {
+    const EngineM::vec3f axis(0, 1, 1);
+    const EngineM::Quaternion a = axisAngle(axis, -0.6f);
+    const EngineM::Quaternion b = axisAngle(axis, 0.6f);
+
+    expectQuaternionNear(EngineM::nlerp(a, b, 0), a, 1e-6f);
+    expectQuaternionNear(EngineM::nlerp(a, b, 1), b, 1e-6f);
+    expectQuaternionNear(EngineM::nlerp(a, b, 0.5f), axisAngle(axis, 0), 1e-6f);
+    expectQuaternionNear(EngineM::nlerp(a, b * -1, 0.5f), axisAngle(axis, 0), 1e-6f);
+
+    EXPECT_NEAR(EngineM::nlerp(a, b, 0.3f).norm(), 1, 1e-6f);
+}
+
+TEST(QuaternionTest, SlerpFast) {
+    const EngineM::Quaternion a = axisAngle(EngineM::vec3f(0.2, -1, 0.4), 0.7f);
+    for (int i = 0; i <= 20; i++) {
+        // Rotations up to 360 degrees apart, covering dot products of both signs.
+        const EngineM::Quaternion b = axisAngle(EngineM::vec3f(1, 0.5, 0.25), 0.7f + 0.1f * static_cast<float>(i * i));
+        for (int j = 0; j <= 10; j++) {
+            const float t = 0.1f * static_cast<float>(j);
+            expectQuaternionNear(EngineM::slerpFast(a, b, t), EngineM::slerp(a, b, t), 5e-5f);
+        }
+    }
+}
+
+TEST(QuaternionTest, InterpolateBatch) {
+    const size_t count = 37;
+    std::vector<EngineM::Quaternion> a(count);
+    std::vector<EngineM::Quaternion> b(count);
+    std::vector<float> t(count);
+    for (size_t i = 0; i < count; i++) {
+        const auto k = static_cast<float>(i);
+        a[i] = axisAngle(EngineM::vec3f(std::sin(k), 1, std::cos(k)), 0.3f * k);
+        b[i] = axisAngle(EngineM::vec3f(1, std::cos(2 * k), -0.5f), 0.17f * k - 2);
+        t[i] = std::fmod(0.37f * k, 1.0f);
+    }
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        std::vector<EngineM::Quaternion> normalised(count);
+        std::vector<EngineM::Quaternion> spherical(count);
+        std::vector<EngineM::Quaternion> fast = a;
+        EngineM::nlerp(a, b, t, normalised);
+        EngineM::slerp(a, b, t, spherical);
+        EngineM::slerpFast(fast, b, t, fast);
+
+        for (size_t i = 0; i < count; i++) {
+            expectQuaternionNear(normalised[i], EngineM::nlerp(a[i], b[i], t[i]), 1e-6f);
+            expectQuaternionNear(spherical[i], EngineM::slerp(a[i], b[i], t[i]), 1e-6f);
+            expectQuaternionNear(fast[i], EngineM::slerp(a[i], b[i], t[i]), 5e-5f);
+        }
+    }
+
+    std::vector<float> shorter(count - 1);
+    std::vector<EngineM::Quaternion> out(count);
+    EXPECT_THROW(EngineM::nlerp(a, b, shorter, out), std::invalid_argument);
+    EXPECT_THROW(EngineM::slerp(a, b, shorter, out), std::invalid_argument);
+    EXPECT_THROW(EngineM::slerpFast(a, b, shorter, out), std::invalid_argument);
+}
+
+TEST(QuaternionTest, ToMatrix) {
+    const EngineM::Quaternion q = axisAngle(EngineM::vec3f(1, -2, 0.5), 0.83f);
+    const EngineM::vec3f p(3.5, -1.25, 2);
+
+    const EngineM::mat3f m = EngineM::toMatrix(q);
+    expectVectorNear(m * p, q.rotate(p));
+
+    const EngineM::mat4f m4 = EngineM::toMatrix4(q);
+    for (uint32_t i = 0; i < 3; i++) {
+        for (uint32_t j = 0; j < 3; j++) {
+            EXPECT_FLOAT_EQ(m4[i][j], m[i][j]);
+        }
+        EXPECT_FLOAT_EQ(m4[i][3], 0);
+        EXPECT_FLOAT_EQ(m4[3][i], 0);
+    }
+    EXPECT_FLOAT_EQ(m4[3][3], 1);
+}
+
+TEST(QuaternionTest, FromMatrix) {
+    // Near-half turns about each axis exercise every branch of the extraction.
+    const EngineM::Quaternion rotations[] = {
+        axisAngle(EngineM::vec3f(1, -2, 0.5), 0.83f),
+        axisAngle(EngineM::vec3f(1, 0.1f, 0.2f), 3.1f),
+        axisAngle(EngineM::vec3f(-0.1f, 1, 0.2f), 3.0f),
+        axisAngle(EngineM::vec3f(0.2f, 0.1f, -1), 3.14f),
+        axisAngle(EngineM::vec3f(0, 0, 1), 0)
+    };
+
+    for (const EngineM::Quaternion &q : rotations) {
+        const EngineM::Quaternion r = EngineM::fromMatrix(EngineM::toMatrix(q));
+        expectQuaternionNear(EngineM::fromMatrix(EngineM::toMatrix4(q)), r, 1e-6f);
+
+        // q and -q are the same rotation.
+        expectQuaternionNear(r.a * q.a + r.v * q.v < 0 ? r * -1 : r, q, 1e-5f);
+    }
+}
+
+TEST(QuaternionTest, ToMatrices) {
+    std::vector<EngineM::Quaternion> rotations(37);
+    for (size_t i = 0; i < rotations.size(); i++) {
+        const auto t = static_cast<float>(i);
+        rotations[i] = axisAngle(EngineM::vec3f(std::sin(t), 1, std::cos(t)), 0.2f * t);
+    }
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        std::vector<EngineM::mat3f> packed(rotations.size());
+        std::vector<EngineM::mat3x4f> affine(rotations.size());
+        EngineM::toMatrices(rotations, packed);
+        EngineM::toMatrices(rotations, affine);
+
+        for (size_t n = 0; n < rotations.size(); n++) {
+            const EngineM::mat3f expected = EngineM::toMatrix(rotations[n]);
+            for (uint32_t i = 0; i < 3; i++) {
+                for (uint32_t j = 0; j < 3; j++) {
+                    EXPECT_NEAR(packed[n][i][j], expected[i][j], 1e-6f);
+                    EXPECT_NEAR(affine[n][i][j], expected[i][j], 1e-6f);
+                }
+                EXPECT_FLOAT_EQ(affine[n][i][3], 0);
+            }
+        }
+    }
+
+    std::vector<EngineM::mat3f> out(rotations.size() - 1);
+    EXPECT_THROW(EngineM::toMatrices(rotations, out), std::invalid_argument);
+}
@@ -0,0 +1,79 @@
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "engine-m/simd.h"
+#include "engine-m/utils.h"
+#include "simd_levels.h"
+
+TEST(SIMDTest, FeaturesMatchLevel) {
+    const EngineM::SIMD::Level level = EngineM::SIMD::get_simd_level();
+
+    EXPECT_EQ(level >= EngineM::SIMD::Level::SSE2, EngineM::SIMD::has_feature(EngineM::SIMD::Feature::SSE2));
+    if (level >= EngineM::SIMD::Level::AVX) {
+        EXPECT_TRUE(EngineM::SIMD::has_feature(EngineM::SIMD::Feature::AVX));
+    }
+    if (level >= EngineM::SIMD::Level::AVX2) {
+        EXPECT_TRUE(EngineM::SIMD::has_feature(EngineM::SIMD::Feature::AVX2));
+    }
+    EXPECT_EQ(level == EngineM::SIMD::Level::AVX2_FMA, EngineM::SIMD::has_feature(EngineM::SIMD::Feature::AVX2) && EngineM::SIMD::has_feature(EngineM::SIMD::Feature::FMA));
+
+    const uint32_t features = EngineM::SIMD::get_features();
+    EXPECT_EQ((features & static_cast<uint32_t>(EngineM::SIMD::Feature::FMA)) != 0, EngineM::SIMD::has_feature(EngineM::SIMD::Feature::FMA));
+}
+
+TEST(SIMDTest, LerpSpan) {
+    std::vector<EngineM::vec3f> a, b;
+    for (int i = 0; i < 13; i++) {
+        a.emplace_back(static_cast<float>(i), 2.0f * static_cast<float>(i), -1.0f);
+        b.emplace_back(-static_cast<float>(i), 4.0f, static_cast<float>(i) * 0.5f);
+    }
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        std::vector<EngineM::vec3f> out(a.size());
+        EngineM::lerp(a, b, 0.3f, out);
+
+        for (size_t n = 0; n < a.size(); n++) {
+            const EngineM::vec3f expected = EngineM::lerp(a[n], b[n], 0.3f);
+            EXPECT_NEAR(out[n].x, expected.x, 1e-5);
+            EXPECT_NEAR(out[n].y, expected.y, 1e-5);
+            EXPECT_NEAR(out[n].z, expected.z, 1e-5);
+        }
+    }
+}
+
+TEST(SIMDTest, EvaluatePolynomial) {
+    const std::vector<EngineM::vec3f> coefficients = {{1, -2, 0.5f}, {0, 3, 1}, {2, 0, -1}, {-1, 1, 4}};
+
+    std::vector<float> t;
+    for (int i = 0; i <= 20; i++) {
+        t.push_back(static_cast<float>(i) / 20);
+    }
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        std::vector<EngineM::vec3f> out(t.size());
+        EngineM::evaluatePolynomial(coefficients, t, out);
+
+        for (size_t n = 0; n < t.size(); n++) {
+            EngineM::vec3f expected;
+            float power = 1;
+            for (const EngineM::vec3f &c : coefficients) {
+                expected += c * power;
+                power *= t[n];
+            }
+            EXPECT_NEAR(out[n].x, expected.x, 1e-5);
+            EXPECT_NEAR(out[n].y, expected.y, 1e-5);
+            EXPECT_NEAR(out[n].z, expected.z, 1e-5);
+        }
+    }
+
+    std::vector<EngineM::vec3f> out(t.size() - 1);
+    EXPECT_THROW(EngineM::evaluatePolynomial(coefficients, t, out), std::invalid_argument);
+}
@@ -0,0 +1,145 @@
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "engine-m/simd.h"
+#include "engine-m/quaternion/dual_quaternion.h"
+#include "engine-m/quaternion/skinning.h"
+#include "simd_levels.h"
+
+static EngineM::Quaternion axisAngle(EngineM::vec3f axis, const float angle) {
+    axis.normalise();
+    return {std::cos(angle / 2), axis * std::sin(angle / 2)};
+}
+
+static void expectVectorNear(const EngineM::vec3f &result, const EngineM::vec3f &expected, const float tolerance) {
+    EXPECT_NEAR(result.x, expected.x, tolerance);
+    EXPECT_NEAR(result.y, expected.y, tolerance);
+    EXPECT_NEAR(result.z, expected.z, tolerance);
+}
+
+struct Mesh {
+    std::vector<EngineM::DualQuaternion> bones;
+    std::vector<EngineM::vec4> joints;
+    std::vector<EngineM::vec4f> weights;
+    EngineM::Vec3Array positions;
+    EngineM::Vec3Array normals;
+};
+
+static Mesh makeMesh(const size_t count) {
+    Mesh mesh;
+    for (int b = 0; b < 12; b++) {
+        const auto t = static_cast<float>(b);
+        const EngineM::DualQuaternion bone(axisAngle(EngineM::vec3f(std::sin(t), 1, std::cos(2 * t)), 0.4f * t - 2), EngineM::vec3f(t - 6, 0.5f * t, 2 - 0.25f * t));
+        // -bone is the same transform; blending has to treat both alike.
+        mesh.bones.push_back(b % 3 == 2 ? bone * -1 : bone);
+    }
+
+    mesh.positions = EngineM::Vec3Array(count);
+    mesh.normals = EngineM::Vec3Array(count);
+    for (size_t n = 0; n < count; n++) {
+        const auto t = static_cast<float>(n);
+        const auto i = static_cast<int>(n);
+        mesh.joints.emplace_back(i % 12, (i + 1) % 12, (i * 7 + 3) % 12, (i * 5 + 8) % 12);
+        mesh.weights.emplace_back(0.4f + 0.3f * std::sin(t), 0.3f, n % 4 == 0 ? 0.0f : 0.2f, 0.1f + 0.1f * std::cos(t));
+        mesh.positions.set(n, EngineM::vec3f(std::sin(0.3f * t) * 4, std::sin(0.013f * t) * 3, std::cos(0.7f * t) * 2));
+
+        EngineM::vec3f normal(std::cos(t), 1, std::sin(1.7f * t));
+        normal.normalise();
+        mesh.normals.set(n, normal);
+    }
+    return mesh;
+}
+
+static EngineM::DualQuaternion blend(const Mesh &mesh, const size_t n) {
+    const EngineM::DualQuaternion &first = mesh.bones[mesh.joints[n][0]];
+    EngineM::DualQuaternion out;
+    for (int s = 0; s < 4; s++) {
+        const EngineM::DualQuaternion &bone = mesh.bones[mesh.joints[n][s]];
+        const float d = first.real.a * bone.real.a + first.real.v * bone.real.v;
+        out += bone * (d < 0 ? -mesh.weights[n][s] : mesh.weights[n][s]);
+    }
+    out.normalise();
+    return out;
+}
+
+static void checkSkinning(const size_t count) {
+    const Mesh mesh = makeMesh(count);
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        EngineM::Vec3Array positions(count);
+        EngineM::Vec3Array normals(count);
+        EngineM::skin(mesh.bones, mesh.joints, mesh.weights, mesh.positions, mesh.normals, positions, normals);
+
+        EngineM::Vec3Array inPlace = mesh.positions;
+        EngineM::skin(mesh.bones, mesh.joints, mesh.weights, inPlace, inPlace);
+
+        for (size_t n = 0; n < count; n++) {
+            const EngineM::DualQuaternion transform = blend(mesh, n);
+            expectVectorNear(positions.get(n), transform.transformPoint(mesh.positions.get(n)), 1e-4f);
+            expectVectorNear(normals.get(n), transform.transformVector(mesh.normals.get(n)), 1e-5f);
+            expectVectorNear(inPlace.get(n), positions.get(n), 1e-6f);
+        }
+    }
+}
+
+TEST(DualQuaternionTest, Transform) {
+    const EngineM::Quaternion rotation = axisAngle(EngineM::vec3f(1, -2, 0.5), 0.83f);
+    const EngineM::vec3f translation(3, -1, 0.5);
+    const EngineM::DualQuaternion dq(rotation, translation);
+    const EngineM::vec3f p(3.5, -1.25, 2);
+
+    expectVectorNear(dq.getTranslation(), translation, 1e-6f);
+    expectVectorNear(dq.transformPoint(p), rotation.rotate(p) + translation, 1e-5f);
+    expectVectorNear(dq.transformVector(p), rotation.rotate(p), 1e-5f);
+    expectVectorNear(dq.conjugate().transformPoint(dq.transformPoint(p)), p, 1e-5f);
+
+    const EngineM::DualQuaternion other(axisAngle(EngineM::vec3f(0, 1, 1), -1.2f), EngineM::vec3f(-2, 4, 1));
+    expectVectorNear((dq * other).transformPoint(p), dq.transformPoint(other.transformPoint(p)), 1e-5f);
+}
+
+TEST(DualQuaternionTest, Normalise) {
+    EngineM::DualQuaternion dq = EngineM::DualQuaternion(axisAngle(EngineM::vec3f(1, 1, 0), 0.5f), EngineM::vec3f(1, 2, 3)) * 2.5f;
+    dq.normalise();
+
+    EXPECT_NEAR(dq.real.norm(), 1, 1e-6f);
+    expectVectorNear(dq.getTranslation(), EngineM::vec3f(1, 2, 3), 1e-5f);
+}
+
+TEST(SkinningTest, SingleBone) {
+    Mesh mesh = makeMesh(21);
+    for (size_t n = 0; n < mesh.joints.size(); n++) {
+        mesh.weights[n] = EngineM::vec4f(1, 0, 0, 0);
+    }
+
+    EngineM::Vec3Array positions(mesh.positions.size());
+    EngineM::skin(mesh.bones, mesh.joints, mesh.weights, mesh.positions, positions);
+
+    for (size_t n = 0; n < mesh.joints.size(); n++) {
+        expectVectorNear(positions.get(n), mesh.bones[mesh.joints[n][0]].transformPoint(mesh.positions.get(n)), 1e-5f);
+    }
+}
+
+TEST(SkinningTest, Levels) {
+    checkSkinning(1003);
+}
+
+TEST(SkinningTest, Parallel) {
+    checkSkinning(70001);
+}
+
+TEST(SkinningTest, InvalidInput) {
+    Mesh mesh = makeMesh(16);
+    EngineM::Vec3Array out(16);
+    EngineM::Vec3Array shorter(15);
+
+    EXPECT_THROW(EngineM::skin(mesh.bones, mesh.joints, mesh.weights, mesh.positions, shorter), std::invalid_argument);
+    EXPECT_THROW(EngineM::skin(mesh.bones, mesh.joints, mesh.weights, mesh.positions, mesh.normals, out, shorter), std::invalid_argument);
+    EXPECT_THROW(EngineM::skin(mesh.bones, std::span(mesh.joints).first(15), mesh.weights, mesh.positions, out), std::invalid_argument);
+
+    mesh.joints[5][2] = 12;
+    EXPECT_THROW(EngineM::skin(mesh.bones, mesh.joints, mesh.weights, mesh.positions, out), std::invalid_argument);
+}
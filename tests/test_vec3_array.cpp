@@ -0,0 +1,144 @@
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "engine-m/simd.h"
+#include "engine-m/vector/vec3_array.h"
+#include "simd_levels.h"
+
+static std::vector<EngineM::vec3f> makePoints(const size_t count, const float seed) {
+    std::vector<EngineM::vec3f> points(count);
+    for (size_t n = 0; n < count; n++) {
+        points[n] = EngineM::vec3f(seed + static_cast<float>(n % 7) - 3, seed * 0.5f - static_cast<float>(n % 5), static_cast<float>(n % 3) + seed);
+    }
+    return points;
+}
+
+static void expectVectorNear(const EngineM::vec3f &result, const EngineM::vec3f &expected) {
+    EXPECT_NEAR(result.x, expected.x, 1e-5f);
+    EXPECT_NEAR(result.y, expected.y, 1e-5f);
+    EXPECT_NEAR(result.z, expected.z, 1e-5f);
+}
+
+TEST(Vec3ArrayTest, SizeConstruct) {
+    const EngineM::Vec3Array array(13);
+
+    EXPECT_EQ(array.size(), 13);
+    EXPECT_EQ(array.getStride() % EngineM::Vec3Array::lanes, 0);
+    EXPECT_EQ(array.x().size(), 13);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(array.x().data()) % EngineM::Vec3Array::alignment, 0);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(array.z().data()) % EngineM::Vec3Array::alignment, 0);
+
+    for (size_t n = 0; n < array.size(); n++) {
+        expectVectorNear(array.get(n), EngineM::vec3f());
+    }
+}
+
+TEST(Vec3ArrayTest, RoundTrip) {
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        const std::vector<EngineM::vec3f> points = makePoints(27, 1);
+        const EngineM::Vec3Array array(points);
+
+        for (size_t n = 0; n < points.size(); n++) {
+            EXPECT_EQ(array.x()[n], points[n].x);
+            EXPECT_EQ(array.y()[n], points[n].y);
+            EXPECT_EQ(array.z()[n], points[n].z);
+        }
+
+        std::vector<EngineM::vec3f> result(points.size());
+        array.toPoints(result);
+
+        for (size_t n = 0; n < points.size(); n++) {
+            expectVectorNear(result[n], points[n]);
+        }
+    }
+}
+
+TEST(Vec3ArrayTest, CopyAndMove) {
+    const std::vector<EngineM::vec3f> points = makePoints(5, 2);
+    EngineM::Vec3Array array1(points);
+    const EngineM::Vec3Array array2(array1);
+    const EngineM::Vec3Array array3(std::move(array1));
+
+    EXPECT_EQ(array1.size(), 0);
+    for (size_t n = 0; n < points.size(); n++) {
+        expectVectorNear(array2.get(n), points[n]);
+        expectVectorNear(array3.get(n), points[n]);
+    }
+}
+
+TEST(Vec3ArrayTest, Arithmetic) {
+    const std::vector<EngineM::vec3f> a = makePoints(21, 1);
+    const std::vector<EngineM::vec3f> b = makePoints(21, 4);
+    const EngineM::Vec3Array arrayA(a);
+    const EngineM::Vec3Array arrayB(b);
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        const EngineM::Vec3Array sum = arrayA + arrayB;
+        const EngineM::Vec3Array diff = arrayA - arrayB;
+        const EngineM::Vec3Array scaled = arrayA * 1.5f;
+        const EngineM::Vec3Array cross = arrayA.cross(arrayB);
+        const EngineM::Vec3Array lerp = EngineM::Vec3Array::lerp(arrayA, arrayB, 0.25f);
+
+        std::vector<float> dot(a.size());
+        std::vector<float> length(a.size());
+        arrayA.dot(arrayB, dot);
+        arrayA.length(length);
+
+        for (size_t n = 0; n < a.size(); n++) {
+            expectVectorNear(sum.get(n), a[n] + b[n]);
+            expectVectorNear(diff.get(n), a[n] - b[n]);
+            expectVectorNear(scaled.get(n), a[n] * 1.5f);
+            expectVectorNear(cross.get(n), a[n].cross(b[n]));
+            expectVectorNear(lerp.get(n), a[n] * 0.75f + b[n] * 0.25f);
+            EXPECT_NEAR(dot[n], a[n].dot(b[n]), 1e-4f);
+            EXPECT_NEAR(length[n], a[n].magnitude(), 1e-5f);
+        }
+    }
+}
+
+TEST(Vec3ArrayTest, Normalise) {
+    std::vector<EngineM::vec3f> points = makePoints(19, 2);
+    points[3] = EngineM::vec3f();
+    points[12] = EngineM::vec3f();
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        EngineM::Vec3Array array(points);
+        EngineM::Vec3Array fast(points);
+        array.normalise();
+        fast.normaliseFast();
+
+        for (size_t n = 0; n < points.size(); n++) {
+            EngineM::vec3f expected = points[n];
+            expected.normalise();
+            expectVectorNear(array.get(n), expected);
+            expectVectorNear(fast.get(n), expected);
+        }
+    }
+}
+
+TEST(Vec3ArrayTest, SizeMismatch) {
+    EngineM::Vec3Array array1(4);
+    const EngineM::Vec3Array array2(5);
+
+    std::vector<float> out(4);
+    std::vector<EngineM::vec3f> points(5);
+
+    EXPECT_THROW(array1 += array2, std::invalid_argument);
+    EXPECT_THROW(array1.dot(array2, out), std::invalid_argument);
+    EXPECT_THROW(array1.cross(array2), std::invalid_argument);
+    EXPECT_THROW(array1.toPoints(points), std::invalid_argument);
+}
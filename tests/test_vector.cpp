@@ -1,9 +1,18 @@
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "engine-m/vector/vector.h"
+#include "engine-m/vector/vec3a.h"
+#include "engine-m/vector/vector_buffer.h"
+#include "engine-m/vector/vector_compression.h"
 #include "engine-m/quaternion/quaternion.h"
 #include "engine-m/constants.h"
+#include "engine-m/simd.h"
+#include "simd_levels.h"
 
 TEST(Vector2dTest, DefaultConstruct) {
     const EngineM::vec2f v;
@@ -505,6 +514,24 @@ TEST(Vector3dTest, Normalise) {
 
 }
 
+TEST(Vector3dTest, NormaliseFast) {
+    EngineM::vec3f v1(5.3, 2.9, 3.2);
+    EngineM::vec3f v2 = v1;
+    EngineM::vec3f zero;
+
+    static_assert(std::is_same_v<decltype(v1.magnitude()), float>);
+    static_assert(std::is_same_v<decltype(EngineM::vec3().magnitude()), double>);
+
+    v1.normaliseFast();
+    v2.normalise();
+    zero.normaliseFast();
+
+    EXPECT_NEAR(v1.x, v2.x, 1e-6);
+    EXPECT_NEAR(v1.y, v2.y, 1e-6);
+    EXPECT_NEAR(v1.z, v2.z, 1e-6);
+    EXPECT_EQ(zero, EngineM::vec3f());
+}
+
 TEST(Vector3dTest, XY_YZ_XZ) {
     const EngineM::vec3f v1(2.5, 83.2, 0.3);
 
@@ -559,3 +586,248 @@ TEST(Vector4dTest, XY_YZ_XZ_XYZ) {
     EXPECT_FLOAT_EQ(v3.y, 83.2);
     EXPECT_FLOAT_EQ(v3.z, 0.3);
 }
+
+TEST(Vec3ATest, Arithmetic) {
+    const EngineM::vec3f a(5.3, 2.9, -3.2);
+    const EngineM::vec3f b(-1.5, 4.25, 0.75);
+    const EngineM::vec3fa pa = a;
+    const EngineM::vec3fa pb = b;
+
+    auto expectEq = [](const EngineM::vec3fa &result, const EngineM::vec3f &expected) {
+        EXPECT_FLOAT_EQ(result.x, expected.x);
+        EXPECT_FLOAT_EQ(result.y, expected.y);
+        EXPECT_FLOAT_EQ(result.z, expected.z);
+        EXPECT_EQ(result.w, 0);
+    };
+
+    expectEq(pa + pb, a + b);
+    expectEq(pa - pb, a - b);
+    expectEq(pa * 2.5f, a * 2.5f);
+    expectEq(pa / 2.5f, a / 2.5f);
+    expectEq(pa / 0.0f, a / 0.0f);
+    expectEq(-pa, -a);
+    expectEq(pa ^ pb, a ^ b);
+    EXPECT_FLOAT_EQ(pa * pb, a * b);
+    EXPECT_FLOAT_EQ(pa.magnitude(), a.magnitude());
+
+    EngineM::vec3fa normalised = pa;
+    EngineM::vec3f expected = a;
+    normalised.normalise();
+    expected.normalise();
+    expectEq(normalised, expected);
+
+    const EngineM::vec3f back = pa;
+    EXPECT_EQ(back, a);
+}
+
+TEST(Vec3ATest, Constexpr) {
+    constexpr EngineM::vec3fa a(1, 2, 3);
+    constexpr EngineM::vec3fa b(4, 5, 6);
+
+    static_assert(a + b == EngineM::vec3fa(5, 7, 9));
+    static_assert((a ^ b) == EngineM::vec3fa(-3, 6, -3));
+    static_assert(a * b == 32);
+    static_assert(EngineM::vec3f(a) == EngineM::vec3f(1, 2, 3));
+
+    EXPECT_EQ(a ^ b, EngineM::vec3fa(-3, 6, -3));
+}
+
+TEST(VectorBufferTest, TriviallyCopyable) {
+    static_assert(std::is_trivially_copyable_v<EngineM::vec2f>);
+    static_assert(std::is_trivially_copyable_v<EngineM::vec3f>);
+    static_assert(std::is_trivially_copyable_v<EngineM::vec4d>);
+
+    const std::vector<EngineM::vec3f> points = {{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+    const std::span<const float> floats = EngineM::asFloats(std::span<const EngineM::vec3f>(points));
+    ASSERT_EQ(floats.size(), 9);
+    for (uint32_t i = 0; i < 9; i++) {
+        EXPECT_FLOAT_EQ(floats[i], static_cast<float>(i + 1));
+    }
+
+    std::vector<EngineM::vec3f> copy(points.size());
+    EngineM::copyPoints(points, copy);
+    EXPECT_EQ(copy, points);
+    EXPECT_THROW(EngineM::copyPoints(points, std::span(copy).first(2)), std::invalid_argument);
+}
+
+TEST(VectorBufferTest, ConvertAndPack) {
+    const std::vector<EngineM::vec3f> points = {{1.5f, -2, 3}, {4, 5.25f, -6}, {7, 8, 9.75f}};
+
+    std::vector<EngineM::vec3d> doubles(points.size());
+    EngineM::convertPoints(points, doubles);
+    std::vector<EngineM::vec3f> roundtrip(points.size());
+    EngineM::convertPoints(doubles, roundtrip);
+    EXPECT_DOUBLE_EQ(doubles[1][1], 5.25);
+    EXPECT_EQ(roundtrip, points);
+
+    std::vector<float> buffer(4 * points.size(), -1.0f);
+    EngineM::packPoints(points, buffer, 4);
+    for (uint32_t i = 0; i < points.size(); i++) {
+        for (uint32_t j = 0; j < 3; j++) {
+            EXPECT_FLOAT_EQ(buffer[i * 4 + j], points[i][j]);
+        }
+        EXPECT_FLOAT_EQ(buffer[i * 4 + 3], -1.0f);
+    }
+
+    std::vector<EngineM::vec3f> unpacked(points.size());
+    EngineM::unpackPoints(buffer, 4, unpacked);
+    EXPECT_EQ(unpacked, points);
+
+    EXPECT_THROW(EngineM::packPoints(points, std::span(buffer).first(10), 4), std::invalid_argument);
+    EXPECT_THROW(EngineM::unpackPoints(buffer, 2, unpacked), std::invalid_argument);
+}
+
+TEST(VectorBufferTest, NormalisePoints) {
+    std::vector<EngineM::vec3f> points(37);
+    for (size_t i = 0; i < points.size(); i++) {
+        points[i] = EngineM::vec3f(static_cast<float>(i % 5) - 2, static_cast<float>(i % 3), 0.5f * static_cast<float>(i % 7));
+    }
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        std::vector<EngineM::vec3f> exact(points.size());
+        std::vector<EngineM::vec3f> fast = points;
+        EngineM::normalisePoints(points, exact);
+        EngineM::normalisePointsFast(fast, fast);
+
+        for (size_t i = 0; i < points.size(); i++) {
+            EngineM::vec3f expected = points[i];
+            expected.normalise();
+            for (int j = 0; j < 3; j++) {
+                EXPECT_FLOAT_EQ(exact[i][j], expected[j]);
+                EXPECT_NEAR(fast[i][j], expected[j], 1e-6);
+            }
+        }
+    }
+
+    std::vector<EngineM::vec3f> out(points.size() - 1);
+    EXPECT_THROW(EngineM::normalisePoints(points, out), std::invalid_argument);
+}
+
+static std::vector<EngineM::vec3f> makeNormals(const size_t count) {
+    std::vector<EngineM::vec3f> normals(count);
+    for (size_t i = 0; i < count; i++) {
+        const float theta = 0.37f * static_cast<float>(i);
+        const float z = 1.0f - 2.0f * static_cast<float>(i) / static_cast<float>(count - 1);
+        const float r = std::sqrt(1.0f - z * z);
+        normals[i] = EngineM::vec3f(r * std::cos(theta), r * std::sin(theta), z);
+    }
+    normals[1] = EngineM::vec3f(0, 0, -1);
+    normals[2] = EngineM::vec3f(-1, 0, 0);
+    normals[3] = EngineM::vec3f(0, 1, 0);
+    return normals;
+}
+
+template <typename V>
+concept HasArithmetic = requires(V a) { a + a; a * 2; a.magnitude(); };
+
+TEST(VectorCompressionTest, StorageOnly) {
+    static_assert(!HasArithmetic<EngineM::vec3h>);
+    static_assert(!HasArithmetic<EngineM::vec3sn>);
+    static_assert(!HasArithmetic<EngineM::vec2sn>);
+    static_assert(HasArithmetic<EngineM::vec3f>);
+    static_assert(!std::is_same_v<EngineM::vec3sn, EngineM::Vector<int16_t, 3>>);
+
+    const EngineM::vec3sn v(1, -2, 3);
+    EXPECT_EQ(v[1], -2);
+    EXPECT_EQ(v, EngineM::vec3sn(1, -2, 3));
+    EXPECT_NE(v, EngineM::vec3sn());
+}
+
+TEST(VectorCompressionTest, Half) {
+    EXPECT_EQ(EngineM::floatToHalf(1.0f), 0x3c00);
+    EXPECT_EQ(EngineM::floatToHalf(-2.0f), 0xc000);
+    EXPECT_EQ(EngineM::floatToHalf(65504.0f), 0x7bff);
+    EXPECT_EQ(EngineM::floatToHalf(65520.0f), 0x7c00);
+    EXPECT_EQ(EngineM::floatToHalf(5.9604645e-8f), 0x0001);
+    EXPECT_EQ(EngineM::floatToHalf(1e-8f), 0x0000);
+    EXPECT_EQ(EngineM::floatToHalf(1.0f / 3.0f), 0x3555);
+    EXPECT_FLOAT_EQ(EngineM::halfToFloat(0x3555), 0.33325195f);
+
+    // Every non-NaN half survives a round trip through float.
+    for (uint32_t h = 0; h <= 0xffff; h++) {
+        if ((h & 0x7c00) == 0x7c00 && (h & 0x03ff) != 0) {
+            continue;
+        }
+        EXPECT_EQ(EngineM::floatToHalf(EngineM::halfToFloat(static_cast<uint16_t>(h))), h);
+    }
+
+    std::vector<EngineM::vec3f> points(37);
+    for (size_t i = 0; i < points.size(); i++) {
+        const float k = static_cast<float>(i) - 18;
+        points[i] = EngineM::vec3f(k * 1.1f, k * k * 97.3f, 1e-6f * k);
+    }
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        std::vector<EngineM::vec3h> encoded(points.size());
+        std::vector<EngineM::vec3f> decoded(points.size());
+        EngineM::encodeHalf(points, encoded);
+        EngineM::decodeHalf(encoded, decoded);
+
+        for (size_t i = 0; i < points.size(); i++) {
+            for (int j = 0; j < 3; j++) {
+                EXPECT_EQ(encoded[i][j], EngineM::floatToHalf(points[i][j]));
+                EXPECT_EQ(decoded[i][j], EngineM::halfToFloat(encoded[i][j]));
+            }
+        }
+    }
+}
+
+TEST(VectorCompressionTest, Snorm) {
+    std::vector<EngineM::vec3f> points = makeNormals(37);
+    points[5] = EngineM::vec3f(2, -3, 0.5);
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        std::vector<EngineM::vec3sn> encoded(points.size());
+        std::vector<EngineM::vec3f> decoded(points.size());
+        EngineM::encodeSnorm(points, encoded);
+        EngineM::decodeSnorm(encoded, decoded);
+
+        EXPECT_EQ(encoded[5], EngineM::vec3sn(32767, -32767, 16384));
+        for (size_t i = 0; i < points.size(); i++) {
+            for (int j = 0; j < 3; j++) {
+                EXPECT_EQ(encoded[i][j], static_cast<int16_t>(std::lrint(std::clamp(points[i][j], -1.0f, 1.0f) * 32767)));
+                EXPECT_NEAR(decoded[i][j], std::clamp(points[i][j], -1.0f, 1.0f), 0.5f / 32767);
+            }
+        }
+    }
+}
+
+TEST(VectorCompressionTest, Octahedral) {
+    const std::vector<EngineM::vec3f> normals = makeNormals(41);
+
+    const ActiveLevelGuard guard;
+
+    std::vector<EngineM::vec2sn> expected(normals.size());
+    EngineM::SIMD::set_active_level(EngineM::SIMD::Level::Scalar);
+    EngineM::encodeOctahedral(normals, expected);
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+
+        std::vector<EngineM::vec2sn> encoded(normals.size());
+        std::vector<EngineM::vec3f> decoded(normals.size());
+        EngineM::encodeOctahedral(normals, encoded);
+        EngineM::decodeOctahedral(encoded, decoded);
+
+        for (size_t i = 0; i < normals.size(); i++) {
+            EXPECT_EQ(encoded[i], expected[i]);
+            EXPECT_NEAR(decoded[i].magnitude(), 1, 1e-6);
+            EXPECT_GT(decoded[i] * normals[i], 0.99999f);
+        }
+    }
+
+    std::vector<EngineM::vec3f> out(normals.size() - 1);
+    EXPECT_THROW(EngineM::decodeOctahedral(expected, out), std::invalid_argument);
+}
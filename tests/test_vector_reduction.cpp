@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "engine-m/simd.h"
+#include "engine-m/vector/vector_reduction.h"
+#include "simd_levels.h"
+
+static std::vector<EngineM::vec3f> makePoints(const size_t count) {
+    std::vector<EngineM::vec3f> points(count);
+    for (size_t n = 0; n < count; n++) {
+        const auto t = static_cast<float>(n);
+        points[n] = EngineM::vec3f(std::sin(t * 0.7f) * 3 + 1, std::cos(t * 1.3f) * 2 - 4, std::sin(t * 0.11f) * 5 + 0.5f * std::cos(t));
+    }
+    return points;
+}
+
+// Sequential double-precision reference for every reduction.
+static void checkReductions(const std::vector<EngineM::vec3f> &points) {
+    const EngineM::vec3f direction(0.48f, -0.6f, 0.64f);
+
+    double sum[3] {};
+    EngineM::vec3f min = points[0];
+    EngineM::vec3f max = points[0];
+    float dotMin = points[0] * direction;
+    float dotMax = dotMin;
+    for (const EngineM::vec3f &p : points) {
+        for (int c = 0; c < 3; c++) {
+            sum[c] += p[c];
+            min[c] = std::min(min[c], p[c]);
+            max[c] = std::max(max[c], p[c]);
+        }
+        dotMin = std::min(dotMin, p * direction);
+        dotMax = std::max(dotMax, p * direction);
+    }
+    const auto n = static_cast<double>(points.size());
+    const double mean[3] = {sum[0] / n, sum[1] / n, sum[2] / n};
+
+    double covariance[3][3] {};
+    for (const EngineM::vec3f &p : points) {
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                covariance[i][j] += (p[i] - mean[i]) * (p[j] - mean[j]) / n;
+            }
+        }
+    }
+
+    const EngineM::AABB bounds = EngineM::computeBounds(points);
+    const EngineM::vec3f total = EngineM::computeSum(points);
+    const EngineM::vec3f centroid = EngineM::computeCentroid(points);
+    const EngineM::mat3f cov = EngineM::computeCovariance(points);
+    const EngineM::DotRange range = EngineM::computeDotRange(points, direction);
+
+    EXPECT_EQ(bounds.min, min);
+    EXPECT_EQ(bounds.max, max);
+    EXPECT_NEAR(range.min, dotMin, 1e-5);
+    EXPECT_NEAR(range.max, dotMax, 1e-5);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_NEAR(total[i], sum[i], 1e-5 * std::max(std::abs(sum[i]), n));
+        EXPECT_NEAR(centroid[i], mean[i], 1e-5);
+        for (int j = 0; j < 3; j++) {
+            EXPECT_NEAR(cov[i][j], covariance[i][j], 1e-4);
+        }
+    }
+}
+
+TEST(VectorReductionTest, Levels) {
+    const std::vector<EngineM::vec3f> points = makePoints(1003);
+
+    const ActiveLevelGuard guard;
+
+    for (const EngineM::SIMD::Level level : supportedLevels()) {
+        EngineM::SIMD::set_active_level(level);
+        checkReductions(points);
+    }
+}
+
+TEST(VectorReductionTest, Parallel) {
+    // Large enough to be split across threads on multi-core machines.
+    checkReductions(makePoints(300001));
+}
+
+TEST(VectorReductionTest, Covariance) {
+    // Points along a line have all their variance along its direction.
+    std::vector<EngineM::vec3f> points;
+    for (int i = -50; i <= 50; i++) {
+        points.emplace_back(EngineM::vec3f(1, 2, 3) + EngineM::vec3f(2, 1, -2) * static_cast<float>(i));
+    }
+
+    const EngineM::mat3f cov = EngineM::computeCovariance(points);
+    const float variance = 850;
+    const EngineM::vec3f axis(2, 1, -2);
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            EXPECT_NEAR(cov[i][j], variance * axis[i] * axis[j], 1e-2);
+        }
+    }
+    EXPECT_EQ(EngineM::computeCentroid(points), EngineM::vec3f(1, 2, 3));
+}
+
+TEST(VectorReductionTest, Empty) {
+    const std::vector<EngineM::vec3f> points;
+
+    EXPECT_EQ(EngineM::computeSum(points), EngineM::vec3f());
+    EXPECT_THROW(EngineM::computeBounds(points), std::invalid_argument);
+    EXPECT_THROW(EngineM::computeCentroid(points), std::invalid_argument);
+    EXPECT_THROW(EngineM::computeCovariance(points), std::invalid_argument);
+    EXPECT_THROW(EngineM::computeDotRange(points, EngineM::vec3f(1, 0, 0)), std::invalid_argument);
+}